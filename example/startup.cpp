@@ -0,0 +1,49 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include <ioh.hpp>
+
+/******************************************************************************
+ * This benchmark measures the time-to-main of a binary that includes the
+ * whole library, i.e. the static initialization of the problem and suite
+ * factories. It launches itself repeatedly, with an argument that makes the
+ * child return from main immediately, and reports the mean wall time of a
+ * launch. An optional reference command, i.e. `true`, is timed in the same
+ * way, so the difference is the cost of the static initialization.
+ *
+ * Usage: startup [launches [reference command]]
+ *****************************************************************************/
+
+double mean_launch_time(const std::string &command, const int launches)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (auto i = 0; i < launches; ++i)
+        if (std::system(command.c_str()) != 0)
+        {
+            std::cerr << "ERROR: " << command << " failed" << std::endl;
+            exit(1);
+        }
+    const auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+    return elapsed.count() / launches;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc > 1 && std::string(argv[1]) == "--child")
+        return 0;
+
+    const auto launches = argc > 1 ? std::stoi(argv[1]) : 100;
+
+    std::cout << "Registered problems: "
+              << ioh::problem::ProblemRegistry<ioh::problem::Real>::instance().names().size() << " real, "
+              << ioh::problem::ProblemRegistry<ioh::problem::Integer>::instance().names().size() << " integer"
+              << std::endl;
+
+    std::cout << "Time to main: " << mean_launch_time("\"" + std::string(argv[0]) + "\" --child", launches) << " ms"
+              << std::endl;
+
+    if (argc > 2)
+        std::cout << "Reference (" << argv[2] << "): " << mean_launch_time(argv[2], launches) << " ms" << std::endl;
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "common/cache.hpp"  
 #include "common/config.hpp"  
 #include "common/container_utils.hpp"  
 #include "common/factory.hpp"  
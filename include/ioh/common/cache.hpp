@@ -0,0 +1,359 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include "ioh/common/config.hpp"
+#include "ioh/common/file.hpp"
+#include "ioh/common/log.hpp"
+
+//! The version of the library, which is part of the key of the cached instances
+#ifndef IOH_VERSION
+#define IOH_VERSION "0.3.2.6"
+#endif
+
+//! Cache namespace
+namespace ioh::common::cache
+{
+    //! The data of a cached instance, as a list of arrays
+    using Sections = std::vector<std::vector<double>>;
+
+    /**
+     * @brief Identifies the generated data of a problem instance
+     *
+     * Besides the problem id, instance and dimension, the key holds the name of the generated data, and any other
+     * parameters it depends on, such as a conditioning. Together with the version of the library, they are hashed
+     * into the name of the file.
+     */
+    struct Key
+    {
+        //! The name of the generated data, i.e. "bbob-transformation"
+        std::string kind;
+
+        //! The id of the problem
+        int problem_id;
+
+        //! The instance of the problem
+        int instance;
+
+        //! The dimension of the problem
+        int n_variables;
+
+        //! Other parameters the data depends on
+        std::vector<double> parameters{};
+
+        //! FNV-1a hash of the kind, the parameters and the version of the library
+        [[nodiscard]] uint64_t hash() const
+        {
+            auto h = uint64_t{14695981039346656037ull};
+            const auto add = [&h](const void *data, const size_t size) {
+                const auto *bytes = static_cast<const unsigned char *>(data);
+                for (size_t i = 0; i < size; ++i)
+                    h = (h ^ bytes[i]) * 1099511628211ull;
+            };
+            const std::string version = IOH_VERSION;
+            add(version.data(), version.size() + 1);
+            add(kind.data(), kind.size() + 1);
+            add(parameters.data(), parameters.size() * sizeof(double));
+            return h;
+        }
+
+        //! The name of the file of the instance
+        [[nodiscard]] std::string file_name() const
+        {
+            return fmt::format("{}-f{}-i{}-d{}-{:016x}.bin", kind, problem_id, instance, n_variables, hash());
+        }
+    };
+
+    namespace detail
+    {
+        //! The header of a cache file, followed by the sizes of the sections, and the sections
+        struct Header
+        {
+            char magic[8];
+            uint64_t key_hash;
+            int32_t problem_id;
+            int32_t instance;
+            int32_t n_variables;
+            uint32_t n_sections;
+            uint64_t checksum;
+        };
+
+        //! Identifies a cache file, including the version of the format
+        constexpr char magic[8] = {'I', 'O', 'H', 'C', 'A', 'C', 'H', '1'};
+
+        //! Checksum of the data of a cache file, FNV-1a over 64 bit words, which can be continued from a previous h
+        inline uint64_t checksum(const char *data, const size_t size, uint64_t h = 14695981039346656037ull)
+        {
+            for (size_t i = 0; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+            {
+                uint64_t word;
+                std::memcpy(&word, data + i, sizeof(word));
+                h = (h ^ word) * 1099511628211ull;
+            }
+            return h;
+        }
+    } // namespace detail
+
+    /**
+     * @brief Opt-in on-disk cache of the generated data of problem instances, such as rotations and peaks.
+     *
+     * When enabled, the problems that generate expensive data from their seed first look for it in the cache
+     * directory, and store it there after generating it. Files are read straight into the arrays of the instance,
+     * and validated against their key, the version of the library and a checksum; invalid files are ignored, and
+     * overwritten. New files are
+     * written under a temporary name and then renamed, so concurrent processes never see a partial file. No new
+     * files are written once the directory holds max_size bytes of cached instances.
+     *
+     * The cache is disabled by default, unless the environment variable IOH_INSTANCE_CACHE names a directory.
+     */
+    class InstanceCache
+    {
+        //! The configuration of the cache
+        struct Settings
+        {
+            std::optional<fs::path> directory;
+            size_t max_size;
+        };
+
+        //! Guards the settings, which may be changed while problems are constructed in other threads
+        static std::mutex &settings_mutex()
+        {
+            static std::mutex mutex;
+            return mutex;
+        }
+
+        //! The settings, which should only be accessed with settings_mutex() held
+        static Settings &settings()
+        {
+            static Settings settings_ = [] {
+                const auto *directory = std::getenv("IOH_INSTANCE_CACHE");
+                if (directory != nullptr && *directory != '\0')
+                    return Settings{fs::path(directory), default_max_size};
+                return Settings{std::nullopt, default_max_size};
+            }();
+            return settings_;
+        }
+
+        //! A copy of the current settings
+        static Settings current_settings()
+        {
+            std::lock_guard<std::mutex> lock(settings_mutex());
+            return settings();
+        }
+
+        //! The total size of the cache files in the directory
+        static uintmax_t directory_size(const fs::path &directory)
+        {
+            uintmax_t size = 0;
+            std::error_code ec;
+            for (const auto &entry : fs::directory_iterator(directory, ec))
+            {
+                if (entry.path().extension() != ".bin")
+                    continue;
+                const auto file_size = entry.file_size(ec);
+                if (!ec)
+                    size += file_size;
+            }
+            return size;
+        }
+
+    public:
+        //! The default maximum size of the cache directory, 1 GiB
+        static constexpr size_t default_max_size = size_t{1} << 30;
+
+        /**
+         * @brief Enable the cache
+         *
+         * @param directory the directory holding the cached instances, which is created when needed
+         * @param max_size the maximum total size of the cached instances in bytes
+         */
+        static void enable(const fs::path &directory, const size_t max_size = default_max_size)
+        {
+            std::lock_guard<std::mutex> lock(settings_mutex());
+            settings() = {directory, max_size};
+        }
+
+        //! Disable the cache
+        static void disable()
+        {
+            std::lock_guard<std::mutex> lock(settings_mutex());
+            settings().directory = std::nullopt;
+        }
+
+        //! Whether the cache is enabled
+        static bool enabled() { return current_settings().directory.has_value(); }
+
+        //! The directory of the cache, if enabled
+        static std::optional<fs::path> directory() { return current_settings().directory; }
+
+        /**
+         * @brief Load the data of an instance
+         *
+         * @param key the key of the instance
+         * @return std::optional<Sections> the data, or nothing if the cache is disabled, or holds no valid file
+         */
+        static std::optional<Sections> load(const Key &key)
+        {
+            const auto directory = current_settings().directory;
+            if (!directory)
+                return std::nullopt;
+
+            const auto path = *directory / key.file_name();
+            std::error_code ec;
+            const auto file_size = fs::file_size(path, ec);
+            std::ifstream stream(path, std::ios::binary);
+            if (ec || !stream || file_size < sizeof(detail::Header))
+                return std::nullopt;
+
+            detail::Header header{};
+            stream.read(reinterpret_cast<char *>(&header), sizeof(header));
+            if (!stream || std::memcmp(header.magic, detail::magic, sizeof(detail::magic)) != 0 ||
+                header.key_hash != key.hash() || header.problem_id != key.problem_id ||
+                header.instance != key.instance || header.n_variables != key.n_variables ||
+                header.n_sections > (file_size - sizeof(header)) / sizeof(uint64_t))
+            {
+                IOH_DBG(warning, "Ignoring invalid instance cache file " << path)
+                return std::nullopt;
+            }
+
+            std::vector<uint64_t> sizes(header.n_sections);
+            stream.read(reinterpret_cast<char *>(sizes.data()),
+                        static_cast<std::streamsize>(sizes.size() * sizeof(uint64_t)));
+            const auto offset = sizeof(header) + sizes.size() * sizeof(uint64_t);
+
+            // The sizes are checked one by one, so their sum cannot overflow
+            const uint64_t capacity = (file_size - offset) / sizeof(double);
+            uint64_t n_values = 0;
+            auto fits = true;
+            for (const auto size : sizes)
+            {
+                fits = fits && size <= capacity - n_values;
+                if (fits)
+                    n_values += size;
+            }
+
+            if (!stream || !fits || offset + n_values * sizeof(double) != file_size)
+            {
+                IOH_DBG(warning, "Ignoring corrupted instance cache file " << path)
+                return std::nullopt;
+            }
+
+            // The sections are read in place, and checksummed as they are read
+            Sections sections(sizes.size());
+            auto checksum = detail::checksum(nullptr, 0);
+            for (size_t i = 0; i < sizes.size() && stream; ++i)
+            {
+                sections[i].resize(sizes[i]);
+                auto *data = reinterpret_cast<char *>(sections[i].data());
+                stream.read(data, static_cast<std::streamsize>(sizes[i] * sizeof(double)));
+                checksum = detail::checksum(data, sizes[i] * sizeof(double), checksum);
+            }
+            if (!stream || checksum != header.checksum)
+            {
+                IOH_DBG(warning, "Ignoring corrupted instance cache file " << path)
+                return std::nullopt;
+            }
+            return sections;
+        }
+
+        /**
+         * @brief Store the data of an instance
+         *
+         * @param key the key of the instance
+         * @param sections the data of the instance
+         * @return true if the data was written to the cache
+         */
+        static bool store(const Key &key, const Sections &sections)
+        {
+            const auto current = current_settings();
+            if (!current.directory)
+                return false;
+
+            const auto &directory = *current.directory;
+            std::error_code ec;
+            create_directories(directory, ec);
+
+            auto file_size = sizeof(detail::Header) + sections.size() * sizeof(uint64_t);
+            for (const auto &section : sections)
+                file_size += section.size() * sizeof(double);
+
+            if (directory_size(directory) + file_size > current.max_size)
+            {
+                IOH_DBG(debug, "Instance cache is full, not storing " << key.file_name())
+                return false;
+            }
+
+            std::vector<char> data;
+            data.reserve(file_size - sizeof(detail::Header));
+            for (const auto &section : sections)
+            {
+                const auto size = static_cast<uint64_t>(section.size());
+                const auto *bytes = reinterpret_cast<const char *>(&size);
+                data.insert(data.end(), bytes, bytes + sizeof(size));
+            }
+            const auto offset = data.size();
+            for (const auto &section : sections)
+            {
+                const auto *bytes = reinterpret_cast<const char *>(section.data());
+                data.insert(data.end(), bytes, bytes + section.size() * sizeof(double));
+            }
+
+            detail::Header header{};
+            std::memcpy(header.magic, detail::magic, sizeof(detail::magic));
+            header.key_hash = key.hash();
+            header.problem_id = key.problem_id;
+            header.instance = key.instance;
+            header.n_variables = key.n_variables;
+            header.n_sections = static_cast<uint32_t>(sections.size());
+            header.checksum = detail::checksum(data.data() + offset, data.size() - offset);
+
+            const auto path = directory / key.file_name();
+            const auto temporary = directory / fmt::format("{}.{:08x}.tmp", key.file_name(), std::random_device()());
+            {
+                std::ofstream stream(temporary, std::ios::binary);
+                stream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+                stream.write(data.data(), static_cast<std::streamsize>(data.size()));
+                if (!stream)
+                {
+                    IOH_DBG(warning, "Could not write instance cache file " << temporary)
+                    stream.close();
+                    fs::remove(temporary, ec);
+                    return false;
+                }
+            }
+            fs::rename(temporary, path, ec);
+            if (ec)
+            {
+                fs::remove(temporary, ec);
+                return false;
+            }
+            return true;
+        }
+    };
+
+    //! Flatten a matrix into a section, row by row
+    inline std::vector<double> to_section(const std::vector<std::vector<double>> &matrix)
+    {
+        std::vector<double> section;
+        for (const auto &row : matrix)
+            section.insert(section.end(), row.begin(), row.end());
+        return section;
+    }
+
+    //! Reshape a section into a matrix with the given number of rows
+    inline std::vector<std::vector<double>> from_section(const std::vector<double> &section, const size_t rows)
+    {
+        std::vector<std::vector<double>> matrix(rows);
+        const auto columns = rows == 0 ? 0 : section.size() / rows;
+        for (size_t i = 0; i < rows; ++i)
+            matrix[i].assign(section.begin() + i * columns, section.begin() + (i + 1) * columns);
+        return matrix;
+    }
+} // namespace ioh::common::cache
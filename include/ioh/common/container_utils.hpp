@@ -2,6 +2,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <map>
 #include <utility>
 #include <vector>
@@ -11,6 +13,30 @@ namespace ioh
     namespace common
     {
         /**
+             * \brief Checks a double for a nan value, from its bits, so that the check holds under -ffast-math
+             * \param x value to be checked
+             * \return true if x is a nan value
+             */
+            inline bool is_nan(const double x)
+            {
+                uint64_t bits;
+                std::memcpy(&bits, &x, sizeof bits);
+                return (bits & 0x7ff0000000000000ULL) == 0x7ff0000000000000ULL && (bits & 0x000fffffffffffffULL) != 0;
+            }
+
+            /**
+             * \brief Checks a double for an inf value, from its bits, so that the check holds under -ffast-math
+             * \param x value to be checked
+             * \return true if x is an inf value
+             */
+            inline bool is_inf(const double x)
+            {
+                uint64_t bits;
+                std::memcpy(&bits, &x, sizeof bits);
+                return (bits & 0x7fffffffffffffffULL) == 0x7ff0000000000000ULL;
+            }
+
+            /**
              * \brief Checks a vector of doubles for nan values
              * \param x vector to be checked
              * \return true if x contains a nan value
@@ -18,7 +44,7 @@ namespace ioh
             inline bool has_nan(const std::vector<double> &x)
             {
                 for (const auto &e : x)
-                    if (std::isnan(e))
+                    if (is_nan(e))
                         return true;
                 return false;
             }
@@ -31,7 +57,7 @@ namespace ioh
             inline bool all_finite(const std::vector<double> &x)
             {
                 for (const auto &e : x)
-                    if (!std::isfinite(e))
+                    if (is_nan(e) || is_inf(e))
                         return false;
                 return true;
             }
@@ -44,7 +70,7 @@ namespace ioh
             inline bool has_inf(const std::vector<double> &x)
             {
                 for (const auto &e : x)
-                    if (std::isinf(e))
+                    if (is_inf(e))
                         return true;
                 return false;
             }
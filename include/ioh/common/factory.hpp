@@ -143,6 +143,36 @@ namespace ioh::common
         std::map<int, std::string> id_map;
     };
 
+    //! Detects whether T declares its id as compile-time metadata, in a static `meta_problem_id` member
+    template <typename T, typename = void>
+    struct HasMetaProblemId : std::false_type
+    {
+    };
+
+    //! Detects whether T declares its id as compile-time metadata, in a static `meta_problem_id` member
+    template <typename T>
+    struct HasMetaProblemId<T, std::void_t<decltype(T::meta_problem_id)>> : std::true_type
+    {
+    };
+
+    /**
+     * \brief Get the id of a problem class
+     *
+     * Problems that declare their id as compile-time metadata are registered without being constructed, which keeps
+     * the static initialization of the factories cheap. Otherwise, an instance of T is constructed to read its id.
+     *
+     * \tparam T the problem class
+     * \return the id of T
+     */
+    template <typename T>
+    int problem_id()
+    {
+        if constexpr (HasMetaProblemId<T>::value)
+            return T::meta_problem_id;
+        else
+            return T(1, 1).meta_data().problem_id;
+    }
+
     //! Helper to get a new ID for a given class
     template <bool IsProblem>
     struct IdGetter
@@ -153,11 +183,11 @@ namespace ioh::common
     template <>
     struct IdGetter<true>
     {
-        //! Gets an from the class meta_data
+        //! Gets the id from the metadata of the class
         template <typename T>
         static int get_id(const std::vector<int> &)
         {
-            return T(1, 1).meta_data().problem_id;
+            return problem_id<T>();
         }
     };
 
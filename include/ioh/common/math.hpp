@@ -0,0 +1,214 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+//! Force inlining of the functions in ioh::common::math, which is needed for loops calling them to be vectorized
+#if defined(__GNUC__)
+#define IOH_MATH_INLINE inline __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#define IOH_MATH_INLINE __forceinline
+#else
+#define IOH_MATH_INLINE inline
+#endif
+
+/**
+ * @brief Vectorizable elementary functions.
+ *
+ * The functions in this namespace are branch-free and inline, and do not call into libm, so a loop applying them to
+ * each element of a vector can be vectorized by the compiler. All special cases are handled by selects rather than
+ * branches. GCC vectorizes such loops at -O3 when floating point operations are allowed to not trap, i.e. with
+ * -fno-trapping-math, which is implied by the -ffast-math of the release build.
+ *
+ * Error bounds with IEEE semantics, relative to the correctly rounded result:
+ * - exp: below 4e-16 for results in the normal range, with correct handling of overflow, underflow and NaN
+ * - log: below 4e-16 for all x, returning -inf for 0 and NaN for negative x
+ * - sin, cos: below 4e-16 in absolute terms for |x| <= 1e5, the error grows linearly with |x| beyond that, up to
+ *   1e9, where they fall back to std::sin and std::cos. With -ffast-math and glibc, the fallback is still
+ *   vectorized, through the vector variants of libmvec
+ * - pow: exp(y log(x)) for x > 0, so the relative error is about (1 + |y log(x)|) * 4e-16
+ *
+ * With -ffast-math, the compiler may merge the steps of the range reductions, which increases the error of exp to
+ * about 1e-13, and that of sin and cos to about 1e-16 |x|. Special values (NaN, inf) are then no longer handled.
+ */
+namespace ioh::common::math
+{
+    namespace detail
+    {
+        //! Reinterpret the bits of a double as an integer
+        IOH_MATH_INLINE int64_t as_int(const double x)
+        {
+            int64_t i;
+            std::memcpy(&i, &x, sizeof i);
+            return i;
+        }
+
+        //! Reinterpret the bits of an integer as a double
+        IOH_MATH_INLINE double as_double(const int64_t i)
+        {
+            double x;
+            std::memcpy(&x, &i, sizeof x);
+            return x;
+        }
+
+        //! Round to the nearest integer, for |x| < 2^31
+        IOH_MATH_INLINE int32_t round_to_int(const double x) { return static_cast<int32_t>(x + (x < 0. ? -0.5 : 0.5)); }
+
+        //! 2^n for n in [-1022, 1023]
+        IOH_MATH_INLINE double exp2i(const int32_t n) { return as_double(static_cast<int64_t>(n + 1023) << 52); }
+
+        /**
+         * @brief sin(x + shift pi / 2), by reduction of x to [-pi / 2, pi / 2]
+         *
+         * @param x the argument, with |x| <= 1e9
+         * @param shift 0 for the sine, 1 for the cosine
+         * @return double sin(x + shift pi / 2)
+         */
+        IOH_MATH_INLINE double sin_shifted(const double x, const int32_t shift)
+        {
+            constexpr double inv_pi = 3.18309886183790671538e-01;
+            // pi split into parts with 33 significant bits each, so nd * part is exact for |nd| < 2^19
+            constexpr double pi_1 = 3.14159265346825122833e+00;
+            constexpr double pi_2 = 1.21542010126079319532e-10;
+            constexpr double pi_3 = 4.04453249742233291160e-21;
+
+            // x + shift pi / 2 = n pi + r. The order of the arguments of min and max maps NaN to a bound, so the
+            // conversion is always defined
+            const auto half_shift = 0.5 * shift;
+            const auto n = round_to_int(std::min(1e9, std::max(-1e9, x * inv_pi + half_shift)));
+            const auto nd = static_cast<double>(n) - half_shift;
+            const auto r = ((x - nd * pi_1) - nd * pi_2) - nd * pi_3;
+            const auto z = r * r;
+
+            // Taylor polynomial of degree 21, |r| <= pi / 2
+            auto p = 1. / 51090942171709440000.;
+            p = p * z - 1. / 121645100408832000.;
+            p = p * z + 1. / 355687428096000.;
+            p = p * z - 1. / 1307674368000.;
+            p = p * z + 1. / 6227020800.;
+            p = p * z - 1. / 39916800.;
+            p = p * z + 1. / 362880.;
+            p = p * z - 1. / 5040.;
+            p = p * z + 1. / 120.;
+            p = p * z - 1. / 6.;
+            const auto sin_r = r + r * z * p;
+
+            // sin(n pi + r) = (-1)^n sin(r), only valid for |x| <= 1e9 because of the clamping of n
+            return (n & 1) ? -sin_r : sin_r;
+        }
+    } // namespace detail
+
+    /**
+     * @brief Vectorizable exponential function
+     *
+     * @param x the argument
+     * @return double e^x
+     */
+    IOH_MATH_INLINE double exp(const double x)
+    {
+        constexpr double log2e = 1.4426950408889634074;
+        constexpr double ln2_hi = 6.93147180369123816490e-01;
+        constexpr double ln2_lo = 1.90821492927058770002e-10;
+
+        const auto xc = std::min(710., std::max(-746., x));
+        const auto n = detail::round_to_int(xc * log2e);
+        const auto nd = static_cast<double>(n);
+        const auto r = (xc - nd * ln2_hi) - nd * ln2_lo;
+
+        // Taylor polynomial of degree 13, |r| <= ln(2) / 2
+        auto p = 1. / 6227020800.;
+        p = p * r + 1. / 479001600.;
+        p = p * r + 1. / 39916800.;
+        p = p * r + 1. / 3628800.;
+        p = p * r + 1. / 362880.;
+        p = p * r + 1. / 40320.;
+        p = p * r + 1. / 5040.;
+        p = p * r + 1. / 720.;
+        p = p * r + 1. / 120.;
+        p = p * r + 1. / 24.;
+        p = p * r + 1. / 6.;
+        p = p * r + 0.5;
+        p = p * r + 1.;
+        p = p * r + 1.;
+
+        // Scale in two steps, so results in the subnormal range and close to overflow are exact. Because of the
+        // clamping of x, this also overflows to inf and underflows to 0 where the exact result does
+        const auto n1 = n / 2;
+        const auto result = p * detail::exp2i(n1) * detail::exp2i(n - n1);
+        return x != x ? x : result;
+    }
+
+    /**
+     * @brief Vectorizable natural logarithm
+     *
+     * @param x the argument
+     * @return double ln(x)
+     */
+    IOH_MATH_INLINE double log(const double x)
+    {
+        constexpr double ln2_hi = 6.93147180369123816490e-01;
+        constexpr double ln2_lo = 1.90821492927058770002e-10;
+        constexpr double sqrt2 = 1.41421356237309504880;
+
+        // Scale subnormals into the normal range
+        const auto subnormal = x < std::numeric_limits<double>::min();
+        const auto xs = subnormal ? x * 18014398509481984. : x;
+        const auto bits = detail::as_int(xs);
+
+        // x = m 2^e, with m in [sqrt(2) / 2, sqrt(2))
+        auto e = static_cast<int32_t>((bits >> 52) & 0x7ff) - 1023 - (subnormal ? 54 : 0);
+        auto m = detail::as_double((bits & 0x000fffffffffffffLL) | 0x3ff0000000000000LL);
+        const auto large = m > sqrt2;
+        m = large ? m * 0.5 : m;
+        e = large ? e + 1 : e;
+
+        // ln(m) = 2 atanh(s), with |s| <= 3 - 2 sqrt(2)
+        const auto s = (m - 1.) / (m + 1.);
+        const auto z = s * s;
+        auto p = 1. / 21.;
+        p = p * z + 1. / 19.;
+        p = p * z + 1. / 17.;
+        p = p * z + 1. / 15.;
+        p = p * z + 1. / 13.;
+        p = p * z + 1. / 11.;
+        p = p * z + 1. / 9.;
+        p = p * z + 1. / 7.;
+        p = p * z + 1. / 5.;
+        p = p * z + 1. / 3.;
+        const auto ed = static_cast<double>(e);
+        const auto result = ed * ln2_hi + ((2. * s * z * p + ed * ln2_lo) + 2. * s);
+
+        const auto special = x != x || x == std::numeric_limits<double>::infinity();
+        const auto result_or_special = special ? x : result;
+        const auto result_or_zero = x == 0. ? -std::numeric_limits<double>::infinity() : result_or_special;
+        return x < 0. ? std::numeric_limits<double>::quiet_NaN() : result_or_zero;
+    }
+
+    /**
+     * @brief Vectorizable sine function
+     *
+     * @param x the argument
+     * @return double sin(x)
+     */
+    IOH_MATH_INLINE double sin(const double x) { return std::fabs(x) > 1e9 ? std::sin(x) : detail::sin_shifted(x, 0); }
+
+    /**
+     * @brief Vectorizable cosine function
+     *
+     * @param x the argument
+     * @return double cos(x)
+     */
+    IOH_MATH_INLINE double cos(const double x) { return std::fabs(x) > 1e9 ? std::cos(x) : detail::sin_shifted(x, 1); }
+
+    /**
+     * @brief Vectorizable power function, for a positive base
+     *
+     * @param x the base, which should be positive
+     * @param y the exponent
+     * @return double x^y
+     */
+    IOH_MATH_INLINE double pow(const double x, const double y) { return math::exp(y * math::log(x)); }
+} // namespace ioh::common::math
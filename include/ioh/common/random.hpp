@@ -1,7 +1,6 @@
 #pragma once
 
 #include <array>
-#include <cassert>
 #include <cmath>
 #include <limits>
 #include <random>
@@ -201,28 +200,27 @@ namespace ioh::common::random
                 random_number = generators[index];
                 generators[index] = seed;
 
-                x.at(i) = random_number / 2.147483647e9;
-                if (x.at(i) == 0.)
-                    x.at(i) = 1e-99;
+                x[i] = random_number / 2.147483647e9;
+                if (x[i] == 0.)
+                    x[i] = 1e-99;
 
-                x.at(i) = x.at(i) * (ub - lb) + lb;
+                x[i] = x[i] * (ub - lb) + lb;
             }
             return x;
         }
 
         inline std::vector<double> normal(const size_t n, const long seed, const double lb = 0, const double ub = 1)
         {
-            assert(2 * n < 6000);
             const auto uniform_random = uniform(2 * n, seed);
 
             std::vector<double> x(n);
 
             for (size_t i = 0; i < n; i++)
             {
-                x.at(i) = sqrt(-2 * std::log(uniform_random[i])) * cos(2 * IOH_PI * uniform_random[n + i]);
-                if (x.at(i) == 0.)
-                    x.at(i) = 1e-99;
-                x.at(i) = x.at(i) * (ub - lb) + lb;
+                x[i] = sqrt(-2 * std::log(uniform_random[i])) * cos(2 * IOH_PI * uniform_random[n + i]);
+                if (x[i] == 0.)
+                    x[i] = 1e-99;
+                x[i] = x[i] * (ub - lb) + lb;
             }
             return x;
         } // namespace random
@@ -2,6 +2,7 @@
 
 #include <functional>
 #include <memory>
+#include <optional>
 
 #include "ioh/common/timer.hpp"
 #include "ioh/logger.hpp"
@@ -44,6 +45,16 @@ namespace ioh
          */
         int independent_runs_ = 1;
 
+        /**
+         * \brief The maximum number of evaluations of a run, if any
+         */
+        std::optional<int> budget_;
+
+        /**
+         * \brief The precision at which the target of a run is reached, if any
+         */
+        std::optional<double> target_precision_;
+
     public:
         Experimenter() = delete;
         Experimenter(const Experimenter &) = delete;
@@ -69,6 +80,10 @@ namespace ioh
         /**
          * \brief Runs the experiment; Evaluates `algorithm_` on all problems X instances X dimensions,
          * for N = independent_runs_ repeated runs.
+         *
+         * When a budget or a target precision is set, a run is aborted as soon as the algorithm evaluates the
+         * problem after the budget is spent or the target is reached. The previous budget, target and termination
+         * policy of each problem are restored after its runs.
          */
         void run()
         {
@@ -76,11 +91,32 @@ namespace ioh
             for (const auto &p : *suite_)
             {
                 const auto p_timer = common::CpuTimer();
+                const auto budget = p->budget();
+                const auto target = p->target_value();
+                const auto termination = p->termination();
+                if (budget_)
+                    p->set_budget(*budget_);
+                if (target_precision_)
+                    p->set_target(*target_precision_);
+                if (budget_ || target_precision_)
+                    p->set_termination(problem::Termination::Abort);
+
                 for (auto count = 0; count < independent_runs_; ++count)
                 {
-                    algorithm_(p);
+                    try
+                    {
+                        algorithm_(p);
+                    }
+                    catch (const problem::RunTerminated &)
+                    {
+                        // The budget is spent or the target is reached, the run is over
+                    }
                     p->reset();
                 }
+
+                p->set_budget(budget);
+                p->set_target_value(target);
+                p->set_termination(termination);
             }
         }
 
@@ -95,6 +131,29 @@ namespace ioh
          */
         [[nodiscard]] int independent_runs() const { return this->independent_runs_; }
 
+        /**
+         * \brief Set's the maximum number of evaluations of a run, see \ref ioh::problem::Problem::set_budget
+         * \param n The number of evaluations
+         */
+        void budget(const int n) { this->budget_ = n; }
+
+        /**
+         * \brief Get's the maximum number of evaluations of a run, if any
+         */
+        [[nodiscard]] std::optional<int> budget() const { return this->budget_; }
+
+        /**
+         * \brief Set's the precision at which the target of a run is reached, see
+         * \ref ioh::problem::Problem::set_target
+         * \param precision The distance to the optimum
+         */
+        void target_precision(const double precision) { this->target_precision_ = precision; }
+
+        /**
+         * \brief Get's the precision at which the target of a run is reached, if any
+         */
+        [[nodiscard]] std::optional<double> target_precision() const { return this->target_precision_; }
+
         /**
          * \brief Get method for `suite_`
          * \return Private `suite_`
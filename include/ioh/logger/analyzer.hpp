@@ -275,6 +275,9 @@ namespace ioh::logger
                 //! Current log info
                 logger::Info log_info_{};
 
+                //! Copy of the variables of the current log info, which outlives the problem state it was viewing
+                std::vector<double> log_info_x_;
+
                 //! Evals
                 size_t evals_;
 
@@ -283,8 +286,8 @@ namespace ioh::logger
                 {
                     if (info_stream_.is_open())
                         info_stream_.close();
-                    info_stream_ = std::ofstream(
-                        path_ / fmt::format("IOHprofiler_f{:d}_{}.info", problem.problem_id, problem.name));
+                    info_stream_ =
+                        open_file(path_ / fmt::format("IOHprofiler_f{:d}_{}.info", problem.problem_id, problem.name));
                 }
 
                 //! Gets called after the last evaluation of a run
@@ -361,6 +364,8 @@ namespace ioh::logger
                  * @param algorithm_info The string indicating a comment.
                  * @param store_positions Whether to store x positions in the logged data
                  * @param attributes See: analyzer::Attributes.
+                 * @param append_on_reopen If true, the files of a problem attached again are appended to instead of
+                 * being truncated, so that switching back to a problem keeps its earlier runs.
                  */
                 Analyzer(const Triggers &triggers = {trigger::on_improvement},
                          const Properties &additional_properties = {},
@@ -369,9 +374,10 @@ namespace ioh::logger
                          const std::string &algorithm_name = "algorithm_name",
                          const std::string &algorithm_info = "algorithm_info",
                          const bool store_positions = false,
-                         const structures::Attributes &attributes = {}) :
+                         const structures::Attributes &attributes = {},
+                         const bool append_on_reopen = false) :
                     FlatFile(triggers, common::concatenate(default_properties_, additional_properties), "", {}, " ", "",
-                             "None", "\n", true, store_positions, {}),
+                             "None", "\n", true, store_positions, {}, append_on_reopen),
                     path_(root, folder_name), algorithm_(algorithm_name, algorithm_info), best_point_{},
                     attributes_(attributes), has_started_(false)
                 {
@@ -413,6 +419,8 @@ namespace ioh::logger
                 {
                     IOH_DBG(debug, "Analyzer log");
                     log_info_ = log_info;
+                    log_info.current.x.copy_to(log_info_x_);
+                    log_info_.current.x = log_info_x_;
                     FlatFile::log(log_info);
                 }
 
@@ -476,6 +484,9 @@ namespace ioh::logger
                 //! Accessor for output directory
                 virtual fs::path output_directory() const override { return path_.path(); }
 
+                //! The best point is stored with its variables
+                [[nodiscard]] bool reads_variables() const override { return true; }
+
             private:
                 static inline watch::Evaluations evaluations_{R"#("function evaluation")#"};
                 static inline watch::CurrentY current_y_{R"#("current f(x)")#"};
@@ -115,6 +115,13 @@ namespace ioh::logger
             }
         }
 
+        //! Does any of the combined loggers read the variables?
+        [[nodiscard]] bool reads_variables() const override
+        {
+            return std::any_of(_loggers.begin(), _loggers.end(),
+                               [](const auto &logger) { return logger.get().reads_variables(); });
+        }
+
         /** @} */
     };
 }
@@ -307,6 +307,9 @@ namespace logger {
                 ));
         }
 
+        /** Only objective values are logged. */
+        [[nodiscard]] bool reads_variables() const override { return false; }
+
         /** Reset the state. */
         void reset() override
         {
@@ -507,6 +507,9 @@ namespace ioh
                     dim)][static_cast<int>(_current.ins)].size());
             }
 
+            /** Only objective values are logged. */
+            [[nodiscard]] bool reads_variables() const override { return false; }
+
             /** Actually store information about the last evaluation.
              */
             void call(const Info &log_info) override
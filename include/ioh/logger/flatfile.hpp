@@ -1,5 +1,7 @@
 #pragma once
 
+#include <set>
+
 #include <fmt/compile.h>
 #include <fmt/format.h>
 
@@ -47,6 +49,9 @@ namespace ioh::logger
         //! Store x positions?
         const bool store_positions_;
 
+        //! Append to the files opened again, rather than truncating them?
+        const bool append_on_reopen_;
+
         //! Requires header?
         bool requires_header_;
 
@@ -71,6 +76,17 @@ namespace ioh::logger
         //! Current meta data
         std::string current_meta_data_;
 
+        //! Files already opened by this logger
+        std::set<fs::path> opened_files_;
+
+        //! Open a file, which is truncated the first time only if append_on_reopen_, every time otherwise.
+        std::ofstream open_file(const fs::path &path)
+        {
+            if (opened_files_.insert(path).second || !append_on_reopen_)
+                return std::ofstream(path);
+            return std::ofstream(path, std::ios::app | std::ios::ate);
+        }
+
         //! Open a file
         void open_stream(const std::string &filename, const fs::path &output_directory)
         {
@@ -92,7 +108,7 @@ namespace ioh::logger
             if (!out_.is_open())
             {
                 IOH_DBG(debug, "will output data in " << output_directory_ / filename_)
-                out_ = std::ofstream(output_directory_ / filename_);
+                out_ = open_file(output_directory_ / filename_);
                 requires_header_ = true;
             }
         }
@@ -112,6 +128,8 @@ namespace ioh::logger
          * @param store_positions Whether to store x positions in the logged data
          * @param common_header_titles Seven strings to print in the header for the common problem meta data (property
          * names are automatically printed after).
+         * @param append_on_reopen If true, a file opened again by this logger, e.g. when attaching a problem again,
+         * is appended to instead of being truncated.
          */
         FlatFile(std::vector<std::reference_wrapper<Trigger>> triggers,
                  std::vector<std::reference_wrapper<Property>> properties, const std::string &filename = "IOH.dat",
@@ -121,12 +139,14 @@ namespace ioh::logger
                  const bool store_positions = false,
                  const std::vector<std::string> &common_header_titles = {"suite_name", "problem_name", "problem_id",
                                                                          "problem_instance", "optimization_type",
-                                                                         "dimension", "run"}) :
+                                                                         "dimension", "run"},
+                 const bool append_on_reopen = false) :
             Watcher(triggers, properties),
             sep_(separator), com_(comment), eol_(end_of_line), nan_(no_value),
             common_header_(format("{}", fmt::join(common_header_titles.begin(), common_header_titles.end(), sep_)) +
                            (common_header_titles.empty() ? "" : sep_)),
-            repeat_header_(repeat_header), store_positions_(store_positions), requires_header_(true),
+            repeat_header_(repeat_header), store_positions_(store_positions), append_on_reopen_(append_on_reopen),
+            requires_header_(true),
             log_meta_data_(!common_header_titles.empty()), output_directory_(output_directory), filename_(filename),
             current_suite_("unknown_suite"), current_run_(0), current_meta_data_{}
         {
@@ -179,12 +199,16 @@ namespace ioh::logger
             }
 
             if (store_positions_)
-                out_ << sep_ << format("{:f}", fmt::join(log_info.current.x, sep_));
+                for (size_t i = 0; i < log_info.current.x.size(); i++)
+                    out_ << sep_ << fmt::format("{:f}", log_info.current.x[i]);
 
             out_ << eol_;
             out_.flush();
         }
 
+        //! The positions are only read when they are stored
+        [[nodiscard]] bool reads_variables() const override { return store_positions_; }
+
         //! Accessor for output directory
         virtual fs::path output_directory() const { return output_directory_; }
 
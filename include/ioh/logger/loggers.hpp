@@ -219,6 +219,13 @@ namespace ioh {
         //! Shutdown behaviour
         virtual void close() { }       
 
+        /** Does the logger read the variables of the solutions, i.e. `log_info.current.x`?
+         *
+         * A problem only tracks the variables of its solutions while a logger that reads them is attached,
+         * see problem::StateTracking. Loggers that only watch objective values should return false.
+         */
+        [[nodiscard]] virtual bool reads_variables() const { return true; }
+
         virtual ~Logger() = default;
 
         /** Access the attached problem's metadata. */
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <memory>
 #include <stdexcept>
 
 #include "ioh/problem/structures.hpp"
@@ -9,15 +11,127 @@ namespace ioh {
     /** Shared structure related to loggers. */
     namespace logger {
 
+        /** A view of the variables of a solution, in the native type of the problem.
+         *
+         * The view does not own the variables by default, it points to the state of the problem that created it,
+         * so it is only valid during the call to the logger. Values are converted to double on access, so nothing
+         * is converted or allocated unless the variables are actually read. Loggers that keep an Info beyond the
+         * call should store an \ref owning copy of the variables.
+         *
+         * @ingroup Logging
+         */
+        class VariablesView
+        {
+            //! The variables, if the problem is of integer type
+            const int *ints_ = nullptr;
+
+            //! The variables, if the problem is of floating point type
+            const double *doubles_ = nullptr;
+
+            //! The number of variables
+            size_t size_ = 0;
+
+            //! The storage of an owning view
+            std::shared_ptr<const std::vector<double>> storage_;
+
+        public:
+            VariablesView() = default;
+
+            //! View of integer variables
+            VariablesView(const std::vector<int> &x) : ints_(x.data()), size_(x.size()) {}
+
+            //! View of floating point variables
+            VariablesView(const std::vector<double> &x) : doubles_(x.data()), size_(x.size()) {}
+
+            //! A view which owns a copy of the variables
+            static VariablesView owning(std::vector<double> x)
+            {
+                VariablesView view;
+                view.storage_ = std::make_shared<const std::vector<double>>(std::move(x));
+                view.doubles_ = view.storage_->data();
+                view.size_ = view.storage_->size();
+                return view;
+            }
+
+            //! The number of variables
+            [[nodiscard]] size_t size() const { return size_; }
+
+            //! Is the view empty?
+            [[nodiscard]] bool empty() const { return size_ == 0; }
+
+            //! The variables as integers, or nullptr if the problem is not of integer type
+            [[nodiscard]] const int *ints() const { return ints_; }
+
+            //! The variables as doubles, or nullptr if the problem is not of floating point type
+            [[nodiscard]] const double *doubles() const { return doubles_; }
+
+            //! The i-th variable, converted to double
+            double operator[](const size_t i) const
+            {
+                return ints_ != nullptr ? static_cast<double>(ints_[i]) : doubles_[i];
+            }
+
+            //! Copy the variables, converted to double, into x
+            void copy_to(std::vector<double> &x) const
+            {
+                x.resize(size_);
+                if (ints_ != nullptr)
+                    std::copy(ints_, ints_ + size_, x.begin());
+                else if (doubles_ != nullptr)
+                    std::copy(doubles_, doubles_ + size_, x.begin());
+            }
+
+            //! The variables, converted to double
+            [[nodiscard]] std::vector<double> as_double() const
+            {
+                std::vector<double> x;
+                copy_to(x);
+                return x;
+            }
+        };
+
+        /** A view of a solution, with the variables in the native type of the problem.
+         *
+         * @ingroup Logging
+         */
+        struct SolutionView
+        {
+            //! The variables of the solution
+            VariablesView x;
+
+            //! The objective value of the solution
+            double y = std::numeric_limits<double>::signaling_NaN();
+
+            SolutionView() = default;
+
+            //! View of a solution, which must outlive the view
+            template <typename T>
+            SolutionView(const problem::Solution<T> &solution) : x(solution.x), y(solution.y)
+            {
+            }
+
+            //! A view which owns a copy of the solution
+            static SolutionView owning(problem::Solution<double> solution)
+            {
+                SolutionView view;
+                view.x = VariablesView::owning(std::move(solution.x));
+                view.y = solution.y;
+                return view;
+            }
+
+            //! The solution, with the variables converted to double
+            [[nodiscard]] problem::Solution<double> as_double() const { return {x.as_double(), y}; }
+        };
+
         /** Information about the current log.
-         * 
+         *
          * @note The properties for bests values holds a state since the first start or the last call to reset.
-         * 
+         *
          * @note "transformed" indicates that a monotonic transformation is applied,
          *       which is specific to the currently configured problem _instance_.
-         * 
+         *
          * @note If there is an improvement, then fields holding "best" values will have the same value than the others.
-         * 
+         *
          * @ingroup Logging
         */
         struct Info
@@ -27,20 +141,19 @@ namespace ioh {
 
             //! The current best internal objective function value (since the last reset).
             double raw_y_best; // was y_best
-            
+
             //! The current transformed objective function value.
             double transformed_y;
-            
+
             //! The current best transformed objective function value (since the last reset).
             double transformed_y_best;
-            
-            //! Currently considered solution with the corresponding transformed objective function value.
-            problem::Solution<double> current;
-            
+
+            //! Currently considered solution with the corresponding transformed objective function value, as a view.
+            SolutionView current;
+
             //! Optimum to the current problem instance, with the corresponding transformed objective function value.
             problem::Solution<double> optimum; // was objective
         };
 
     } // log
 } // ioh
-
@@ -2,6 +2,7 @@
 
 #include "problem/transformation.hpp"
 #include "problem/problem.hpp"
+#include "problem/async.hpp"
 #include "problem/bbob.hpp"
 #include "problem/pbo.hpp"
 
@@ -0,0 +1,270 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <future>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#include "ioh/problem/problem.hpp"
+
+namespace ioh::problem
+{
+    /**
+     * @brief Evaluates a problem asynchronously, on a bounded pool of worker threads
+     *
+     * Solutions are submitted with \ref submit, which returns a future of their objective value right away, so an
+     * algorithm can keep several expensive evaluations in flight, e.g. a steady-state parallel EA. The workers
+     * transform and evaluate the solutions, while the updates of the state of the problem and the calls to its
+     * logger are applied in submission order, so the logs do not depend on the timing of the evaluations. A future
+     * is ready once its solution is committed to the state.
+     *
+     * Only problems which can be evaluated from several threads at once, see \ref
+     * Problem::concurrent_evaluation, use several workers; the others are evaluated on a single worker thread, which
+     * still frees the caller. The problem must not be called directly while evaluations are in flight, see \ref
+     * wait. With memoization enabled, solutions are evaluated synchronously by \ref submit, after the evaluations in
+     * flight.
+     *
+     * @tparam T type of the problem
+     */
+    template <typename T>
+    class AsyncEvaluator
+    {
+        //! A submitted solution, waiting for a worker
+        struct Job
+        {
+            size_t ticket;
+            std::vector<T> x;
+            std::promise<double> promise;
+        };
+
+        //! An evaluated solution, waiting for its turn to be committed
+        struct Evaluation
+        {
+            std::vector<T> x;
+            std::vector<T> x_internal;
+            double y_internal;
+            std::exception_ptr error;
+            std::promise<double> promise;
+        };
+
+        std::shared_ptr<Problem<T>> problem_;
+
+        //! Guards everything below, and the state of the problem
+        std::mutex mutex_;
+
+        //! Signals the workers that a job is queued, or that the evaluator stops
+        std::condition_variable queued_;
+
+        //! Signals that all submitted solutions are committed
+        std::condition_variable idle_;
+
+        std::deque<Job> queue_;
+
+        //! The evaluated solutions which are not committed yet, by ticket
+        std::map<size_t, Evaluation> evaluated_;
+
+        //! The ticket of the next submitted solution
+        size_t next_ticket_ = 0;
+
+        //! The ticket of the next solution to commit
+        size_t next_commit_ = 0;
+
+        bool stopping_ = false;
+
+        std::vector<std::thread> workers_;
+
+        //! Update the state of the problem with an evaluated solution, and log it
+        void commit(Evaluation &evaluation)
+        {
+            auto &p = *problem_;
+            if (evaluation.error)
+                return evaluation.promise.set_exception(evaluation.error);
+
+            if (p.terminated_ && p.termination_ != Termination::Flag)
+            {
+                if (p.termination_ == Termination::Abort)
+                    return evaluation.promise.set_exception(std::make_exception_ptr(RunTerminated()));
+                return evaluation.promise.set_value(std::numeric_limits<double>::signaling_NaN());
+            }
+
+            try
+            {
+                if (p.state_.tracking == StateTracking::Full)
+                    p.state_.current.x = std::move(evaluation.x);
+                p.state_.current_internal.x = std::move(evaluation.x_internal);
+                p.state_.current_internal.y = evaluation.y_internal;
+                evaluation.promise.set_value(p.update_state());
+            }
+            catch (...)
+            {
+                evaluation.promise.set_exception(std::current_exception());
+            }
+        }
+
+        //! Commit the evaluated solutions whose turn has come, requires the lock
+        void commit_ready()
+        {
+            for (auto it = evaluated_.begin(); it != evaluated_.end() && it->first == next_commit_;
+                 it = evaluated_.erase(it), ++next_commit_)
+                commit(it->second);
+
+            if (next_commit_ == next_ticket_)
+                idle_.notify_all();
+        }
+
+        void work()
+        {
+            while (true)
+            {
+                Job job;
+                {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    queued_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+                    if (queue_.empty())
+                        return;
+                    job = std::move(queue_.front());
+                    queue_.pop_front();
+                }
+
+                Evaluation evaluation{std::move(job.x), {}, 0.0, nullptr, std::move(job.promise)};
+                try
+                {
+                    evaluation.x_internal = problem_->transform_variables(evaluation.x);
+                    evaluation.y_internal = problem_->evaluate(evaluation.x_internal);
+                }
+                catch (...)
+                {
+                    evaluation.error = std::current_exception();
+                }
+
+                std::lock_guard<std::mutex> lock(mutex_);
+                evaluated_.emplace(job.ticket, std::move(evaluation));
+                commit_ready();
+            }
+        }
+
+    public:
+        /**
+         * @brief Construct a new Async Evaluator object, which starts the workers
+         *
+         * @param problem the problem to evaluate
+         * @param n_workers the maximum number of solutions evaluated at once, one per hardware thread by default
+         */
+        explicit AsyncEvaluator(std::shared_ptr<Problem<T>> problem,
+                                const size_t n_workers = std::max(std::thread::hardware_concurrency(), 1u)) :
+            problem_(std::move(problem))
+        {
+            const auto n = problem_->concurrent_evaluation() ? std::max(n_workers, size_t{1}) : size_t{1};
+            workers_.reserve(n);
+            for (size_t i = 0; i < n; ++i)
+                workers_.emplace_back([this] { work(); });
+        }
+
+        //! The workers refer to the evaluator, so it cannot be copied
+        AsyncEvaluator(const AsyncEvaluator &) = delete;
+
+        //! The workers refer to the evaluator, so it cannot be copied
+        AsyncEvaluator &operator=(const AsyncEvaluator &) = delete;
+
+        //! Finish the evaluations in flight, then stop the workers
+        ~AsyncEvaluator() { close(); }
+
+        /**
+         * @brief Submit a solution for evaluation
+         *
+         * Invalid solutions, and solutions refused because the problem terminated, see \ref
+         * Problem::set_termination, are not evaluated, and their future is ready with NaN. Under the Abort policy,
+         * submit throws \ref RunTerminated instead, and the futures of solutions committed after the problem
+         * terminated hold it.
+         *
+         * Unless the termination policy is Flag, the solutions in flight count against the budget, so a solution
+         * which would be committed after the budget is spent is refused right away rather than evaluated: its
+         * future is ready with NaN, or holds \ref RunTerminated under Abort.
+         *
+         * @param x the solution
+         * @return std::future<double> the objective value of x, ready once x is committed to the state
+         */
+        std::future<double> submit(std::vector<T> x)
+        {
+            std::promise<double> promise;
+            auto future = promise.get_future();
+
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (stopping_)
+                throw std::runtime_error("The evaluator is closed");
+
+            auto &p = *problem_;
+            if (p.refuse_evaluation() || !p.check_input(x))
+            {
+                promise.set_value(std::numeric_limits<double>::signaling_NaN());
+                return future;
+            }
+
+            if (p.termination_ != Termination::Flag &&
+                static_cast<size_t>(p.state_.evaluations) + (next_ticket_ - next_commit_) >=
+                    static_cast<size_t>(p.budget_))
+            {
+                if (p.termination_ == Termination::Abort)
+                    promise.set_exception(std::make_exception_ptr(RunTerminated()));
+                else
+                    promise.set_value(std::numeric_limits<double>::signaling_NaN());
+                return future;
+            }
+
+            if (p.cache_ != nullptr)
+            {
+                idle_.wait(lock, [this] { return next_commit_ == next_ticket_; });
+                try
+                {
+                    promise.set_value(p(x));
+                }
+                catch (...)
+                {
+                    promise.set_exception(std::current_exception());
+                }
+                return future;
+            }
+
+            queue_.push_back({next_ticket_++, std::move(x), std::move(promise)});
+            lock.unlock();
+            queued_.notify_one();
+            return future;
+        }
+
+        //! Wait until all submitted solutions are committed, after which the problem can be called directly
+        void wait()
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            idle_.wait(lock, [this] { return next_commit_ == next_ticket_; });
+        }
+
+        //! Finish the evaluations in flight, then stop the workers; nothing can be submitted afterwards
+        void close()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stopping_ = true;
+            }
+            queued_.notify_all();
+            for (auto &worker : workers_)
+                if (worker.joinable())
+                    worker.join();
+        }
+
+        //! The number of submitted solutions which are not committed yet
+        [[nodiscard]] size_t in_flight()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return next_ticket_ - next_commit_;
+        }
+
+        //! The number of worker threads
+        [[nodiscard]] size_t n_workers() const { return workers_.size(); }
+
+        //! The evaluated problem
+        [[nodiscard]] std::shared_ptr<Problem<T>> problem() const { return problem_; }
+    };
+} // namespace ioh::problem
@@ -5,25 +5,39 @@
 namespace ioh::problem::bbob
 {
     //! Attractive Sector problem id = 2
-    class AttractiveSector final : public BBOProblem<AttractiveSector>
+    class AttractiveSector : public BBOProblem<AttractiveSector>
     {
     protected:
 
-        //! Evaluation method
-        double evaluate(const std::vector<double> &x) override
+        //! Evaluation method, templated on the container type of x
+        template <typename V>
+        double evaluate_impl(const V &x)
         {
             auto result =  0.0 ;
-            for (auto i = 0; i < meta_data_.n_variables; ++i)
-                result += x.at(i) * x.at(i) * (1. + 9999.0 * (objective_.x.at(i) * x.at(i) > 0.0));
+            for (size_t i = 0; i < x.size(); ++i)
+                result += x[i] * x[i] * (1. + 9999.0 * (objective_.x[i] * x[i] > 0.0));
             return result;
         }
+
+        //! Evaluation method
+        double evaluate(const std::vector<double> &x) override
+        {
+            return evaluate_impl(x);
+        }
         
-        //! Variables transformation method
-        std::vector<double> transform_variables(std::vector<double> x) override
+        //! Variables transformation method, templated on the container type of x
+        template <typename V>
+        void transform_variables_impl(V &x)
         {
             using namespace transformation::variables;
             subtract(x, objective_.x);
             affine(x, transformation_state_.second_transformation_matrix, transformation_state_.transformation_base);
+        }
+
+        //! Variables transformation method
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            transform_variables_impl(x);
             return x;
         }
 
@@ -35,6 +49,12 @@ namespace ioh::problem::bbob
         }
 
     public:
+        //! The id of the problem
+        static constexpr int meta_problem_id = 6;
+
+        //! The name of the problem
+        static constexpr const char *meta_name = "AttractiveSector";
+
         /**
          * @brief Construct a new Attractive Sector object
          * 
@@ -42,7 +62,7 @@ namespace ioh::problem::bbob
          * @param n_variables the dimension of the problem
          */
         AttractiveSector(const int instance, const int n_variables) :
-            BBOProblem(6, instance, n_variables, "AttractiveSector")
+            BBOProblem(meta_problem_id, instance, n_variables, meta_name)
         {
         }
     };
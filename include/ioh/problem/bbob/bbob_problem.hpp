@@ -1,5 +1,9 @@
 #pragma once
 
+#include <atomic>
+#include <future>
+
+#include "ioh/common/cache.hpp"
 #include "ioh/problem/problem.hpp"
 #include "ioh/problem/transformation.hpp"
 
@@ -54,26 +58,82 @@ namespace ioh::problem
                 conditions(n_variables),
                 transformation_matrix(n_variables, std::vector<double>(n_variables)),
                 transformation_base(n_variables),
-                second_transformation_matrix(n_variables, std::vector<double>(n_variables)),
-                first_rotation(compute_rotation(seed + 1000000, n_variables)),
-                second_rotation(compute_rotation(seed, n_variables))
+                second_transformation_matrix(n_variables, std::vector<double>(n_variables))
             {
                 for (auto i = 0; i < n_variables; ++i)
                     exponents[i] = static_cast<double>(i) / (static_cast<double>(n_variables) - 1);
 
+                using common::cache::InstanceCache;
+                const common::cache::Key key{"bbob-transformation", static_cast<int>(problem_id), instance,
+                                             n_variables, {condition}};
+                if (const auto cached = InstanceCache::load(key); cached && cached->size() == 3)
+                {
+                    first_rotation = common::cache::from_section((*cached)[0], n_variables);
+                    second_rotation = common::cache::from_section((*cached)[1], n_variables);
+                    second_transformation_matrix = common::cache::from_section((*cached)[2], n_variables);
+                    transformation_matrix = first_rotation;
+                    return;
+                }
+
+                compute_rotations(n_variables);
                 transformation_matrix = first_rotation;
 
+                // second_transformation_matrix = first_rotation * diag(condition^exponents) * second_rotation,
+                // in row order. Each element is accumulated over k in increasing order, as in the direct formula.
+                std::vector<double> powers(n_variables);
+                for (auto k = 0; k < n_variables; ++k)
+                    powers[k] = pow(condition, exponents[k]);
+
                 for (auto i = 0; i < n_variables; ++i)
-                    for (auto j = 0; j < n_variables; ++j)
-                        for (auto k = 0; k < n_variables; ++k)
-                            second_transformation_matrix[i][j] += first_rotation.at(i).at(k)
-                                * pow(condition, exponents.at(k))
-                                * second_rotation.at(k).at(j);
+                {
+                    auto &row = second_transformation_matrix[i];
+                    for (auto k = 0; k < n_variables; ++k)
+                    {
+                        const auto factor = first_rotation[i][k] * powers[k];
+                        const auto &rotation_row = second_rotation[k];
+                        for (auto j = 0; j < n_variables; ++j)
+                            row[j] += factor * rotation_row[j];
+                    }
+                }
+
+                if (InstanceCache::enabled())
+                    InstanceCache::store(key,
+                                         {common::cache::to_section(first_rotation),
+                                          common::cache::to_section(second_rotation),
+                                          common::cache::to_section(second_transformation_matrix)});
+            }
+
+            //! Compute first_rotation and second_rotation, in parallel if enabled by \ref BBOB::parallel_rotations
+            void compute_rotations(const int n_variables)
+            {
+                if (parallel_rotations && n_variables >= 64)
+                {
+                    try
+                    {
+                        auto first = std::async(std::launch::async, [this, n_variables] {
+                            return compute_rotation(seed + 1000000, n_variables);
+                        });
+                        second_rotation = compute_rotation(seed, n_variables);
+                        first_rotation = first.get();
+                        return;
+                    }
+                    catch (const std::system_error &)
+                    {
+                        IOH_DBG(debug, "Could not start a thread, computing the rotations sequentially")
+                    }
+                }
+                first_rotation = compute_rotation(seed + 1000000, n_variables);
+                second_rotation = compute_rotation(seed, n_variables);
             }
 
             /**
              * @brief Compute a rotation for a problem
-             * 
+             *
+             * Modified Gram-Schmidt orthonormalization of the columns of a random matrix. The columns are stored
+             * contiguously, and processed in blocks: each previous column is loaded once per block, rather than once
+             * per column. Every column still goes through the same sequence of operations as in the unblocked
+             * algorithm, so the result does not depend on the block size.
+             *
              * @param rotation_seed the seed of the rotation
              * @param n_variables the dimension of the problem
              * @return std::vector<std::vector<double>> the rotation
@@ -81,34 +141,51 @@ namespace ioh::problem
             [[nodiscard]]
             std::vector<std::vector<double>> compute_rotation(const long rotation_seed, const int n_variables) const
             {
-                const auto random_vector = common::random::bbob2009::normal(static_cast<size_t>(n_variables) * n_variables, rotation_seed);
-                auto matrix = std::vector<std::vector<double>>(n_variables, std::vector<double>(n_variables));
+                constexpr size_t block_size = 16;
+                const auto n = static_cast<size_t>(n_variables);
 
-                // reshape
-                for (auto i = 0; i < n_variables; i++)
-                    for (auto j = 0; j < n_variables; j++)
-                        matrix[i][j] = random_vector.at(static_cast<size_t>(j) * n_variables + i);
+                // The random vector holds the matrix in column-major order, i.e. column i starts at i * n
+                auto columns = common::random::bbob2009::normal(n * n, rotation_seed);
 
+                // Remove the projection of column i onto the normalized column j
+                const auto orthogonalize = [&columns, n](const size_t i, const size_t j) {
+                    auto *column = columns.data() + i * n;
+                    const auto *other = columns.data() + j * n;
+                    auto prod = 0.0;
+                    for (size_t k = 0; k < n; k++)
+                        prod += column[k] * other[k];
 
-                /*1st coordinate is row, 2nd is column.*/
-                for (long i = 0; i < n_variables; i++)
+                    for (size_t k = 0; k < n; k++)
+                        column[k] -= prod * other[k];
+                };
+
+                for (size_t start = 0; start < n; start += block_size)
                 {
-                    for (long j = 0; j < i; j++)
+                    const auto end = std::min(n, start + block_size);
+                    for (size_t j = 0; j < start; j++)
+                        for (auto i = start; i < end; i++)
+                            orthogonalize(i, j);
+
+                    for (auto i = start; i < end; i++)
                     {
+                        for (auto j = start; j < i; j++)
+                            orthogonalize(i, j);
+
+                        auto *column = columns.data() + i * n;
                         auto prod = 0.0;
-                        for (auto k = 0; k < n_variables; k++)
-                            prod += matrix[k][i] * matrix[k][j];
+                        for (size_t k = 0; k < n; k++)
+                            prod += column[k] * column[k];
 
-                        for (auto k = 0; k < n_variables; k++)
-                            matrix[k][i] -= prod * matrix[k][j];
+                        for (size_t k = 0; k < n; k++)
+                            column[k] /= sqrt(prod);
                     }
-                    auto prod = 0.0;
-                    for (auto k = 0; k < n_variables; k++)
-                        prod += matrix[k][i] * matrix[k][i];
-
-                    for (auto k = 0; k < n_variables; k++)
-                        matrix[k][i] /= sqrt(prod);
                 }
+
+                /*1st coordinate is row, 2nd is column.*/
+                auto matrix = std::vector<std::vector<double>>(n, std::vector<double>(n));
+                for (size_t i = 0; i < n; i++)
+                    for (size_t j = 0; j < n; j++)
+                        matrix[i][j] = columns[j * n + i];
                 return matrix;
             }
         } 
@@ -121,7 +198,27 @@ namespace ioh::problem
             return transformation::objective::shift(y, objective_.y);
         }
 
+        /**
+         * @brief Default variables transformation for any container type, which does nothing.
+         *
+         * Problems that transform their variables implement this method, and call it from transform_variables, so the
+         * same transformation can be applied to the fixed size arrays used by \ref Fixed.
+         */
+        template <typename V>
+        void transform_variables_impl(V &)
+        {
+        }
+
     public:
+        /**
+         * @brief Whether the two rotations of a new instance are computed in parallel, in dimensions of at least 64.
+         *
+         * Disabled by default, as the construction then starts a thread. The rotations are identical either way.
+         * When no thread can be started, they are computed sequentially. The flag is atomic, so it can be set while
+         * other threads construct problems, which see either value.
+         */
+        static inline std::atomic<bool> parallel_rotations{false};
+
         /**
          * @brief Construct a new BBOB object
          * 
@@ -201,4 +298,29 @@ namespace ioh::problem
         {
         }
     };
+
+    /**
+     * @brief Registry for variants of BBOB problems, such as \ref bbob::Fixed.
+     *
+     * Variants are only registered in the factory of Parent, under the name and id given by the static
+     * `registered_name` and `registered_id` methods of the variant. Variants use ids outside the range of the BBOB
+     * functions, so the order in which the static registrations run can never change the id of an original function.
+     *
+     * @tparam Parent the factory to register in
+     */
+    template <typename Parent>
+    struct BBOBVariantRegistry
+    {
+        //! Include T in the factory
+        template <class T>
+        static void include()
+        {
+            auto &factory = ProblemFactoryType<Parent>::instance();
+            const auto name = T::registered_name();
+            const auto id = factory.check_or_get_next_available(T::registered_id(), name);
+            factory.include(name, id, [](const int instance, const int n_variables) {
+                return std::make_unique<T>(instance, n_variables);
+            });
+        }
+    };
 }
@@ -5,21 +5,31 @@
 namespace ioh::problem::bbob
 {
     //! BuecheRastrigin problem id 4
-    class BuecheRastrigin final : public RastriginBase<BuecheRastrigin>
+    class BuecheRastrigin : public RastriginBase<BuecheRastrigin>
     {
         const double penalty_factor_ = 100.0;
 
     protected:
-        //! Variables transformation method
-        std::vector<double> transform_variables(std::vector<double> x) override
+        //! Variables transformation method, templated on the container type of x
+        template <typename V>
+        void transform_variables_impl(V &x)
         {
             using namespace transformation::variables;
             subtract(x, objective_.x);
             oscillate(x);
             brs(x);
+        }
+
+        //! Variables transformation method
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            transform_variables_impl(x);
             return x;
         }
         
+        //! The objective transformation penalizes the current variables, so they are always tracked
+        [[nodiscard]] StateTracking minimum_state_tracking() const override { return StateTracking::Full; }
+
         //! Objectives transformation method
         double transform_objectives(const double y) override
         {
@@ -28,6 +38,12 @@ namespace ioh::problem::bbob
         }
 
     public:
+        //! The id of the problem
+        static constexpr int meta_problem_id = 4;
+
+        //! The name of the problem
+        static constexpr const char *meta_name = "BuecheRastrigin";
+
         /**
          * @brief Construct a new Bueche Rastrigin object
          * 
@@ -35,7 +51,7 @@ namespace ioh::problem::bbob
          * @param n_variables the dimension of the problem
          */
         BuecheRastrigin(const int instance, const int n_variables) :
-            RastriginBase(4, instance, n_variables, "BuecheRastrigin")
+            RastriginBase(meta_problem_id, instance, n_variables, meta_name)
         {
             for (size_t i = 0; i < objective_.x.size(); i += 2)
             {
@@ -5,27 +5,47 @@
 namespace ioh::problem::bbob
 {
     //! Different powers problem id 14
-    class DifferentPowers final : public BBOProblem<DifferentPowers>
+    class DifferentPowers : public BBOProblem<DifferentPowers>
     {
     protected:
-        //! Evaluation method
-        double evaluate(const std::vector<double> &x) override
+        //! Evaluation method, templated on the container type of x
+        template <typename V>
+        double evaluate_impl(const V &x)
         {
             auto sum = 0.0;
-            for (auto i = 0; i < meta_data_.n_variables; ++i)
-                sum += pow(fabs(x.at(i)), transformation_state_.exponents.at(i));
+            for (size_t i = 0; i < x.size(); ++i)
+                sum += pow(fabs(x[i]), transformation_state_.exponents[i]);
             return sqrt(sum);
         }
-        //! Variables transformation method                         
-        std::vector<double> transform_variables(std::vector<double> x) override
+
+        //! Evaluation method
+        double evaluate(const std::vector<double> &x) override
+        {
+            return evaluate_impl(x);
+        }
+        //! Variables transformation method, templated on the container type of x
+        template <typename V>
+        void transform_variables_impl(V &x)
         {
             using namespace transformation::variables;
             subtract(x, objective_.x);
             affine(x, transformation_state_.transformation_matrix, transformation_state_.transformation_base);
+        }
+
+        //! Variables transformation method
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            transform_variables_impl(x);
             return x;
         }
 
     public:
+        //! The id of the problem
+        static constexpr int meta_problem_id = 14;
+
+        //! The name of the problem
+        static constexpr const char *meta_name = "DifferentPowers";
+
         /**
          * @brief Construct a new Different Powers object
          * 
@@ -33,7 +53,7 @@ namespace ioh::problem::bbob
          * @param n_variables the dimension of the problem
          */
         DifferentPowers(const int instance, const int n_variables) :
-            BBOProblem(14, instance, n_variables, "DifferentPowers")
+            BBOProblem(meta_problem_id, instance, n_variables, meta_name)
         {
             for (auto i = 0; i < meta_data_.n_variables; ++i)
                 transformation_state_.exponents[i] = 2.0 + 4.0 * transformation_state_.exponents.at(i);
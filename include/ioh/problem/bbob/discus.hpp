@@ -5,29 +5,49 @@
 namespace ioh::problem::bbob
 {
     //! Discuss function id 11
-    class Discus final : public BBOProblem<Discus>
+    class Discus : public BBOProblem<Discus>
     {
     protected:
-        //! Evaluation method
-        double evaluate(const std::vector<double> &x) override
+        //! Evaluation method, templated on the container type of x
+        template <typename V>
+        double evaluate_impl(const V &x)
         {
             static const auto condition = 1.0e6;
-            auto result = condition * x.at(0) * x.at(0);
-            for (auto i = 1; i < meta_data_.n_variables; ++i)
-                result += x.at(i) * x.at(i);
+            auto result = condition * x[0] * x[0];
+            for (size_t i = 1; i < x.size(); ++i)
+                result += x[i] * x[i];
             return result;
         }
-        //! Variables transformation method
-        std::vector<double> transform_variables(std::vector<double> x) override
+
+        //! Evaluation method
+        double evaluate(const std::vector<double> &x) override
+        {
+            return evaluate_impl(x);
+        }
+        //! Variables transformation method, templated on the container type of x
+        template <typename V>
+        void transform_variables_impl(V &x)
         {
             using namespace transformation::variables;
             subtract(x, objective_.x);
             affine(x, transformation_state_.transformation_matrix, transformation_state_.transformation_base);
             oscillate(x);
+        }
+
+        //! Variables transformation method
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            transform_variables_impl(x);
             return x;
         }
 
     public:
+        //! The id of the problem
+        static constexpr int meta_problem_id = 11;
+
+        //! The name of the problem
+        static constexpr const char *meta_name = "Discus";
+
         /**
          * @brief Construct a new Discus object
          * 
@@ -35,7 +55,7 @@ namespace ioh::problem::bbob
          * @param n_variables the dimension of the problem
          */
         Discus(const int instance, const int n_variables) :
-            BBOProblem(11, instance, n_variables, "Discus")
+            BBOProblem(meta_problem_id, instance, n_variables, meta_name)
         {
         }
     };
@@ -13,21 +13,35 @@ namespace ioh::problem::bbob
     class EllipsoidBase : public BBOProblem<T>
     {
     protected:
+        //! Evaluation method, templated on the container type of x
+        template <typename V>
+        double evaluate_impl(const V &x)
+        {
+            auto result = x[0] * x[0];
+            for (size_t i = 1; i < x.size(); ++i)
+                result += this->transformation_state_.conditions[i] * x[i] * x[i];
+            return result;
+        }
+
         //! Evaluation method
         double evaluate(const std::vector<double> &x) override
         {
-            auto result = x.at(0) * x.at(0);
-            for (auto i = 1; i < this->meta_data_.n_variables; ++i)
-                result += this->transformation_state_.conditions.at(i) * x.at(i) * x.at(i);
-            return result;
+            return evaluate_impl(x);
         }
 
-        //! Variables transformation method
-        std::vector<double> transform_variables(std::vector<double> x) override
+        //! Variables transformation method, templated on the container type of x
+        template <typename V>
+        void transform_variables_impl(V &x)
         {
             using namespace transformation::variables;
             subtract(x, this->objective_.x);
             oscillate(x);
+        }
+
+        //! Variables transformation method
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            transform_variables_impl(x);
             return x;
         }
 
@@ -51,15 +65,21 @@ namespace ioh::problem::bbob
     };
 
     //! Ellipsiod problem id 2
-    class Ellipsoid final : public EllipsoidBase<Ellipsoid>
+    class Ellipsoid : public EllipsoidBase<Ellipsoid>
     {
     public:
+        //! The id of the problem
+        static constexpr int meta_problem_id = 2;
+
+        //! The name of the problem
+        static constexpr const char *meta_name = "Ellipsoid";
+
         /**
          * @brief Construct a new Ellipsoid object
          *
          * @param instance instance id
          * @param n_variables the dimension of the problem
          */
-        Ellipsoid(const int instance, const int n_variables) : EllipsoidBase(2, instance, n_variables, "Ellipsoid") {}
+        Ellipsoid(const int instance, const int n_variables) : EllipsoidBase(meta_problem_id, instance, n_variables, meta_name) {}
     };
 } // namespace ioh::problem::bbob
@@ -5,21 +5,34 @@
 namespace ioh::problem::bbob
 {
     //! Rotated ellipsoid problem id 10
-    class EllipsoidRotated final : public EllipsoidBase<EllipsoidRotated>
+    class EllipsoidRotated : public EllipsoidBase<EllipsoidRotated>
     {
     protected:
-        //! Transoform variables method
-        std::vector<double> transform_variables(std::vector<double> x) override
+        //! Variables transformation method, templated on the container type of x
+        template <typename V>
+        void transform_variables_impl(V &x)
         {
             using namespace transformation::variables;
             subtract(x, objective_.x);
             affine(x, transformation_state_.transformation_matrix,
                                                     transformation_state_.transformation_base);
             oscillate(x);
+        }
+
+        //! Variables transformation method
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            transform_variables_impl(x);
             return x;
         }
 
     public:
+        //! The id of the problem
+        static constexpr int meta_problem_id = 10;
+
+        //! The name of the problem
+        static constexpr const char *meta_name = "EllipsoidRotated";
+
         /**
          * @brief Construct a new Ellipsoid Rotated object
          * 
@@ -27,7 +40,7 @@ namespace ioh::problem::bbob
          * @param n_variables the dimension of the problem
          */
         EllipsoidRotated(const int instance, const int n_variables) :
-            EllipsoidBase(10, instance, n_variables, "EllipsoidRotated")
+            EllipsoidBase(meta_problem_id, instance, n_variables, meta_name)
         {
             static const auto condition = 1.0e6;
             for (auto i = 1; i < meta_data_.n_variables; ++i)
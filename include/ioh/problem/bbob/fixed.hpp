@@ -0,0 +1,81 @@
+#pragma once
+
+#include <array>
+#include <stdexcept>
+
+#include "bbob_problem.hpp"
+
+namespace ioh::problem::bbob
+{
+    /**
+     * @brief A BBOB problem with a dimension fixed at compile time.
+     *
+     * The search point is copied into a std::array of size N, and the transformation and evaluation kernels of
+     * ProblemType (its transform_variables_impl and evaluate_impl methods) are called on that array. All loops in
+     * these kernels then have a constant trip count, so the compiler can fully unroll and vectorize them, and
+     * temporary buffers are kept on the stack. Fixed derives from ProblemType to reach these kernels, which is why
+     * the BBOB problem classes are not final.
+     *
+     * The objective values are those of ProblemType in dimension N, up to rounding errors: with -ffast-math, the
+     * compiler may evaluate the unrolled loops in another order, which changes the values by up to about 1e-11
+     * relative to max(1, |f|). The meta data is that of ProblemType as well, so logged data of both versions can be
+     * compared directly.
+     *
+     * @tparam ProblemType the BBOB problem, e.g. \ref Sphere
+     * @tparam N the dimension of the problem
+     */
+    template <typename ProblemType, int N>
+    class Fixed final : public ProblemType,
+                        common::AutomaticTypeRegistration<Fixed<ProblemType, N>, BBOBVariantRegistry<Real>>
+    {
+        static_assert(std::is_base_of_v<BBOB, ProblemType>, "ProblemType should be a BBOB problem");
+        static_assert(N > 0, "The dimension should be positive");
+
+        //! Fixed size array type
+        using Array = std::array<double, N>;
+
+        //! Copy the first N elements of x into an array
+        static Array to_array(const std::vector<double> &x)
+        {
+            Array array;
+            std::copy_n(x.begin(), N, array.begin());
+            return array;
+        }
+
+    protected:
+        //! Variables transformation method
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            auto array = to_array(x);
+            this->transform_variables_impl(array);
+            std::copy(array.begin(), array.end(), x.begin());
+            return x;
+        }
+
+        //! Evaluation method
+        double evaluate(const std::vector<double> &x) override
+        {
+            return this->evaluate_impl(to_array(x));
+        }
+
+    public:
+        /**
+         * @brief Construct a new Fixed object
+         *
+         * @param instance instance id
+         * @param n_variables the dimension of the problem, which should be N
+         */
+        explicit Fixed(const int instance, const int n_variables = N) : ProblemType(instance, N)
+        {
+            if (n_variables != N)
+                throw std::invalid_argument(fmt::format("The dimension of {} is fixed, got n_variables={}",
+                                                        registered_name(), n_variables));
+        }
+
+        //! The name under which the problem is registered
+        static std::string registered_name() { return fmt::format("{}<{}>", common::class_name<ProblemType>(), N); }
+
+        //! The id under which the problem is registered, if still available
+        static int registered_id() { return 1000 * N + common::problem_id<ProblemType>(); }
+    };
+} // namespace ioh::problem::bbob
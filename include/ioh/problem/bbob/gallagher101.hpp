@@ -1,5 +1,8 @@
 #pragma once
 
+#include <array>
+#include <numeric>
+
 #include "bbob_problem.hpp"
 
 namespace ioh::problem::bbob
@@ -74,49 +77,63 @@ namespace ioh::problem::bbob
             }
         };
 
-        std::vector<std::vector<double>> x_transformation_;
-        std::vector<Peak> peaks_;
+        //! The centres of the peaks, peak-major, with n_variables elements per peak
+        std::vector<double> peak_centres_;
+
+        //! The scales of the peaks, in the same layout as the centres
+        std::vector<double> peak_scales_;
+
+        //! The values of the peaks, in decreasing order
+        std::vector<double> peak_values_;
+
+        //! The logarithms of the values of the peaks
+        std::vector<double> peak_log_values_;
+
         double factor_;
 
-    protected:
-        
-        //! Evaluation method
-        double evaluate(const std::vector<double> &x) override
+        //! Number of points of a block in \ref evaluate_batch
+        static constexpr size_t block_size = 8;
+
+        //! The weighted squared distance of a rotated point y to peak p, a dense loop over contiguous data
+        template <typename V>
+        double peak_distance(const V &y, const size_t p) const
         {
-            static const auto a = 0.1;
-            std::vector<double> x_transformed(this->meta_data_.n_variables);
-            auto penalty = 0.;
+            const auto n = y.size();
+            const auto *centre = peak_centres_.data() + p * n;
+            const auto *scale = peak_scales_.data() + p * n;
+            auto z = 0.0;
+            for (size_t j = 0; j < n; ++j)
+            {
+                const auto d = static_cast<double>(y[j]) - centre[j];
+                z += scale[j] * d * d;
+            }
+            return z;
+        }
 
-            for (auto i = 0; i < this->meta_data_.n_variables; i++)
+        //! Rotate x into y and return the boundary penalty of x
+        template <typename V, typename W>
+        double rotate(const V &x, W &y) const
+        {
+            auto penalty = 0.;
+            for (size_t i = 0; i < x.size(); i++)
             {
-                const auto out_of_bounds = fabs(x.at(i)) - 5.;
+                const auto out_of_bounds = fabs(x[i]) - 5.;
                 if (out_of_bounds > 0.)
                     penalty += out_of_bounds * out_of_bounds;
 
-                x_transformed[i] = std::inner_product(x.begin(), x.end(),
-                                                      this->transformation_state_.second_rotation.at(i).begin(), 0.0);
+                const auto &row = this->transformation_state_.second_rotation[i];
+                auto sum = 0.0;
+                for (size_t k = 0; k < x.size(); ++k)
+                    sum += x[k] * row[k];
+                y[i] = sum;
             }
-#if defined(__GNUC__)
-            #pragma GCC diagnostic push
-            #pragma GCC diagnostic ignored "-Wsequence-point"
-#endif
-            auto result = 10. - std::accumulate(
-                peaks_.begin(), peaks_.end(), 0.0,
-                [&, i = 0](const double sum, const Peak &peak) mutable
-                {
-                    const auto z = std::accumulate(
-                        x_transformed.begin(), x_transformed.end(), 0.0,
-                        [&, j = 0](const double lhs, const double rhs) mutable
-                        {
-                            return lhs + peaks_.at(i).scales.at(j) * pow(rhs - x_transformation_.at(j++).at(i), 2.0);
-                        });
-                    i++;
-                    return std::max(sum, peak.value * exp(factor_ * z));
-                });
-#if defined(__GNUC__)
-            #pragma GCC diagnostic pop
-#endif
+            return penalty;
+        }
 
+        //! The objective value from the value of the highest peak, as seen from the point, and the penalty
+        static double finalize(double result, const double penalty)
+        {
+            static const auto a = 0.1;
             if (result > 0)
             {
                 result = std::log(result) / a;
@@ -131,6 +148,106 @@ namespace ioh::problem::bbob
             return result * result + penalty;
         }
 
+    protected:
+
+        //! Evaluation method, templated on the container type of x
+        template <typename V>
+        double evaluate_impl(const V &x)
+        {
+            auto y = x;
+            const auto penalty = rotate(x, y);
+
+            // The highest peak maximizes factor_ * z + log(value). As z >= 0, no peak with log(value) below the
+            // best score so far can improve on it, and the peaks are sorted by value, so the search stops there
+            auto best_score = -std::numeric_limits<double>::infinity();
+            auto best_peak = size_t{0};
+            auto best_distance = 0.0;
+            for (size_t p = 0; p < peak_values_.size() && peak_log_values_[p] > best_score; ++p)
+            {
+                const auto z = peak_distance(y, p);
+                const auto score = factor_ * z + peak_log_values_[p];
+                if (score > best_score)
+                {
+                    best_score = score;
+                    best_peak = p;
+                    best_distance = z;
+                }
+            }
+            return finalize(10. - peak_values_[best_peak] * exp(factor_ * best_distance), penalty);
+        }
+
+        //! Evaluation method
+        double evaluate(const std::vector<double> &x) override
+        {
+            return evaluate_impl(x);
+        }
+
+        /**
+         * @brief Evaluate a batch of transformed points
+         *
+         * The points are processed in blocks, for which the distances to all peaks are computed together, like a
+         * small matrix product, so the data of each peak is loaded once per block rather than once per point.
+         *
+         * @param xs the transformed points to evaluate
+         * @return std::vector<double> the objective values of the points
+         */
+        std::vector<double> evaluate_batch(const std::vector<std::vector<double>> &xs) override
+        {
+            const auto n = static_cast<size_t>(this->meta_data_.n_variables);
+            std::vector<double> results(xs.size());
+            std::vector<double> y(n), ys(block_size * n);
+            std::array<double, block_size> penalties{}, best_scores{}, best_distances{};
+            std::array<size_t, block_size> best_peaks{};
+
+            for (size_t start = 0; start < xs.size(); start += block_size)
+            {
+                // Rotate a block of points. The rotated points are stored coordinate-major, so the loops over the
+                // points of the block are contiguous
+                const auto count = std::min(block_size, xs.size() - start);
+                for (size_t k = 0; k < count; ++k)
+                {
+                    penalties[k] = rotate(xs[start + k], y);
+                    for (size_t j = 0; j < n; ++j)
+                        ys[j * block_size + k] = y[j];
+                }
+                best_scores.fill(-std::numeric_limits<double>::infinity());
+
+                // Distances of the block to the peaks, until no point of the block can be improved upon
+                for (size_t p = 0; p < peak_values_.size(); ++p)
+                {
+                    if (*std::min_element(best_scores.begin(), best_scores.begin() + count) >= peak_log_values_[p])
+                        break;
+
+                    std::array<double, block_size> z{};
+                    const auto *centre = peak_centres_.data() + p * n;
+                    const auto *scale = peak_scales_.data() + p * n;
+                    for (size_t j = 0; j < n; ++j)
+                    {
+                        const auto *yj = ys.data() + j * block_size;
+                        for (size_t k = 0; k < block_size; ++k)
+                        {
+                            const auto d = yj[k] - centre[j];
+                            z[k] += scale[j] * d * d;
+                        }
+                    }
+
+                    for (size_t k = 0; k < block_size; ++k)
+                    {
+                        const auto score = factor_ * z[k] + peak_log_values_[p];
+                        const auto better = score > best_scores[k];
+                        best_scores[k] = better ? score : best_scores[k];
+                        best_distances[k] = better ? z[k] : best_distances[k];
+                        best_peaks[k] = better ? p : best_peaks[k];
+                    }
+                }
+
+                for (size_t k = 0; k < count; ++k)
+                    results[start + k] =
+                        finalize(10. - peak_values_[best_peaks[k]] * exp(factor_ * best_distances[k]), penalties[k]);
+            }
+            return results;
+        }
+
     public:
         /**
          * @brief Construct a new Gallagher object
@@ -148,34 +265,73 @@ namespace ioh::problem::bbob
                   const int number_of_peaks, const double b = 10., const double c = 5.0,
                   double max_condition = sqrt(1000.)) :
             BBOProblem<T>(problem_id, instance, n_variables, name),
-            x_transformation_(n_variables, std::vector<double>(number_of_peaks)),
-            peaks_(Peak::get_peaks(number_of_peaks, n_variables, this->transformation_state_.seed, max_condition)),
+            peak_centres_(static_cast<size_t>(n_variables) * number_of_peaks),
+            peak_scales_(static_cast<size_t>(n_variables) * number_of_peaks),
             factor_(-0.5 / static_cast<double>(n_variables))
         {
+            using common::cache::InstanceCache;
+            const common::cache::Key key{"gallagher", problem_id, instance, n_variables,
+                                         {static_cast<double>(number_of_peaks), b, c, max_condition}};
+            if (const auto cached = InstanceCache::load(key); cached && cached->size() == 5)
+            {
+                peak_centres_ = (*cached)[0];
+                peak_scales_ = (*cached)[1];
+                peak_values_ = (*cached)[2];
+                peak_log_values_ = (*cached)[3];
+                this->objective_.x = (*cached)[4];
+                return;
+            }
+
             const auto random_numbers = common::random::bbob2009::uniform(
                 static_cast<size_t>(this->meta_data_.n_variables) * number_of_peaks, this->transformation_state_.seed);
+            const auto peaks =
+                Peak::get_peaks(number_of_peaks, n_variables, this->transformation_state_.seed, max_condition);
 
+            // Store the peaks by decreasing value, which allows the early exit of the evaluation
+            std::vector<size_t> order(peaks.size());
+            std::iota(order.begin(), order.end(), 0);
+            std::stable_sort(order.begin(), order.end(),
+                             [&](const size_t i, const size_t j) { return peaks[i].value > peaks[j].value; });
 
-            for (auto i = 0; i < this->meta_data_.n_variables; ++i)
+            const auto n = static_cast<size_t>(n_variables);
+            for (size_t p = 0; p < order.size(); ++p)
             {
-                this->objective_.x[i] = 0.8 * (b * random_numbers[i] - c);
-                for (auto j = 0; j < number_of_peaks; ++j)
+                const auto j = order[p];
+                peak_values_.push_back(peaks[j].value);
+                peak_log_values_.push_back(std::log(peaks[j].value));
+                std::copy(peaks[j].scales.begin(), peaks[j].scales.end(), peak_scales_.begin() + p * n);
+
+                for (size_t i = 0; i < n; ++i)
                 {
-                    for (auto k = 0; k < this->meta_data_.n_variables; ++k)
-                        x_transformation_[i][j] += this->transformation_state_.second_rotation[i][k] * (
-                            b * random_numbers.at(static_cast<size_t>(j) * this->meta_data_.n_variables + k) - c
+                    auto &centre = peak_centres_[p * n + i];
+                    for (size_t k = 0; k < n; ++k)
+                        centre += this->transformation_state_.second_rotation[i][k] * (
+                            b * random_numbers.at(j * n + k) - c
                         );
                     if (j == 0)
-                        x_transformation_[i][j] *= 0.8;
+                        centre *= 0.8;
                 }
             }
+
+            for (auto i = 0; i < this->meta_data_.n_variables; ++i)
+                this->objective_.x[i] = 0.8 * (b * random_numbers[i] - c);
+
+            if (InstanceCache::enabled())
+                InstanceCache::store(key, {peak_centres_, peak_scales_, peak_values_, peak_log_values_,
+                                           this->objective_.x});
         }
     };
 
     //! Gallaher 101 problem id 21
-    class Gallagher101 final : public Gallagher<Gallagher101>
+    class Gallagher101 : public Gallagher<Gallagher101>
     {
     public:
+        //! The id of the problem
+        static constexpr int meta_problem_id = 21;
+
+        //! The name of the problem
+        static constexpr const char *meta_name = "Gallagher101";
+
         /**
          * @brief Construct a new Gallagher 1 0 1 object
          * 
@@ -183,7 +339,7 @@ namespace ioh::problem::bbob
          * @param n_variables the dimension of the problem
          */
         Gallagher101(const int instance, const int n_variables):
-            Gallagher(21, instance, n_variables, "Gallagher101", 101, 10., 5.0)
+            Gallagher(meta_problem_id, instance, n_variables, meta_name, 101, 10., 5.0)
         {
         }
     };
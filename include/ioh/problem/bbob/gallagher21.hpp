@@ -5,9 +5,15 @@
 namespace ioh::problem::bbob
 {
     //! Gallagher 21 problem id 22
-    class Gallagher21 final : public Gallagher<Gallagher21>
+    class Gallagher21 : public Gallagher<Gallagher21>
     {
     public:
+        //! The id of the problem
+        static constexpr int meta_problem_id = 22;
+
+        //! The name of the problem
+        static constexpr const char *meta_name = "Gallagher21";
+
         /**
          * @brief Construct a new Gallagher 2 1 object
          * 
@@ -15,7 +21,7 @@ namespace ioh::problem::bbob
          * @param n_variables the dimension of the problem
          */
         Gallagher21(const int instance, const int n_variables) :
-            Gallagher(22, instance, n_variables, "Gallagher21", 21, 9.8, 4.9, 1000.)
+            Gallagher(meta_problem_id, instance, n_variables, meta_name, 21, 9.8, 4.9, 1000.)
         {
         }
     };
@@ -5,34 +5,54 @@
 namespace ioh::problem::bbob
 {
     //! GriewankRosenBrock problem id 19
-    class GriewankRosenBrock final : public BBOProblem<GriewankRosenBrock>
+    class GriewankRosenBrock : public BBOProblem<GriewankRosenBrock>
     {
         std::vector<double> x_shift_;
     protected:
-        //! Evaluation method
-        double evaluate(const std::vector<double> &x) override
+        //! Evaluation method, templated on the container type of x
+        template <typename V>
+        double evaluate_impl(const V &x)
         {
             auto result = 0.0;
-            for (auto i = 0; i < meta_data_.n_variables - 1; ++i) {
-                const auto c1 = 100.0 * pow(pow(x.at(i), 2.0) - x.at(static_cast<size_t>(i) + 1), 2.0);
-                const auto c2 = pow(1.0 - x.at(i), 2.0);
+            for (size_t i = 0; i < x.size() - 1; ++i) {
+                const auto c1 = 100.0 * pow(pow(x[i], 2.0) - x[i + 1], 2.0);
+                const auto c2 = pow(1.0 - x[i], 2.0);
                 const auto z =  c1 + c2;
                 result += z / 4000. - cos(z);
             }
-            return 10. + 10. * result / (static_cast<double>(meta_data_.n_variables) - 1.);
+            return 10. + 10. * result / (static_cast<double>(x.size()) - 1.);
         }
 
-        //! Variables transformation method
-        std::vector<double> transform_variables(std::vector<double> x) override
+        //! Evaluation method
+        double evaluate(const std::vector<double> &x) override
+        {
+            return evaluate_impl(x);
+        }
+
+        //! Variables transformation method, templated on the container type of x
+        template <typename V>
+        void transform_variables_impl(V &x)
         {
             using namespace transformation::variables;
             affine(x, transformation_state_.second_rotation,
                                                     transformation_state_.transformation_base);
             subtract(x, x_shift_);
+        }
+
+        //! Variables transformation method
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            transform_variables_impl(x);
             return x;
         }
     
     public:
+        //! The id of the problem
+        static constexpr int meta_problem_id = 19;
+
+        //! The name of the problem
+        static constexpr const char *meta_name = "GriewankRosenBrock";
+
         /**
          * @brief Construct a new Griewank Rosen Brock object
          * 
@@ -40,7 +60,7 @@ namespace ioh::problem::bbob
          * @param n_variables the dimension of the problem
          */
         GriewankRosenBrock(const int instance, const int n_variables) :
-            BBOProblem(19, instance, n_variables, "GriewankRosenBrock"),
+            BBOProblem(meta_problem_id, instance, n_variables, meta_name),
             x_shift_(n_variables, -0.5)
         {
             const auto factor = std::max(1., sqrt(n_variables) / 8.);
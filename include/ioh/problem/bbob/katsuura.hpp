@@ -5,40 +5,74 @@
 namespace ioh::problem::bbob
 {
     //! Katsuura problem id 23
-    class Katsuura final : public BBOProblem<Katsuura>
+    class Katsuura : public BBOProblem<Katsuura>
     {
         double exponent_;
         double factor_;
 
     protected:
 
-        //! Evaluation method
-        double evaluate(const std::vector<double> &x) override
+        //! Evaluation method, templated on the container type of x
+        template <typename V>
+        double evaluate_impl(const V &x)
         {
-            auto result = 1.0;
-            for (auto i = 0; i < meta_data_.n_variables; ++i)
+            // The distance of 2^j x_i to the nearest integer is computed from the fractional part of 2^j x_i, which
+            // is updated exactly by doubling for each next j. This needs no rounding and no division, and the sums
+            // are identical to those of the direct formula. The loops over the coordinates can be vectorized.
+            // The buffers are local copies of x, so they are on the stack for the arrays of Fixed.
+            auto fractions = x, sums = x;
+            for (size_t i = 0; i < x.size(); ++i)
             {
-                double z = 0;
-                for (size_t j = 1; j < 33; ++j)
-                    z += fabs(transformation_state_.exponents.at(j) * x.at(i)
-                            - floor(transformation_state_.exponents.at(j) * x.at(i) + 0.5))
-                        / transformation_state_.exponents.at(j);
+                const auto xi = static_cast<double>(x[i]);
+                fractions[i] = xi - floor(xi);
+                sums[i] = 0.0;
+            }
 
-                result *= pow(1.0 + (static_cast<double>(i) + 1) * z, exponent_);
+            auto scale = 1.0;
+            for (auto j = 1; j < 33; ++j)
+            {
+                scale *= 0.5;
+                for (size_t i = 0; i < x.size(); ++i)
+                {
+                    const auto doubled = 2.0 * fractions[i];
+                    const auto fraction = doubled >= 1.0 ? doubled - 1.0 : doubled;
+                    fractions[i] = fraction;
+                    sums[i] += std::min(fraction, 1.0 - fraction) * scale;
+                }
             }
+
+            auto result = 1.0;
+            for (size_t i = 0; i < x.size(); ++i)
+                result *= pow(1.0 + (static_cast<double>(i) + 1) * sums[i], exponent_);
             result = factor_ * (-1. + result);
             return result;
         }
 
-        //! Variables transformation method
-        std::vector<double> transform_variables(std::vector<double> x) override
+        //! Evaluation method
+        double evaluate(const std::vector<double> &x) override
+        {
+            return evaluate_impl(x);
+        }
+
+        //! Variables transformation method, templated on the container type of x
+        template <typename V>
+        void transform_variables_impl(V &x)
         {
             using namespace transformation::variables;
             subtract(x, objective_.x);
             affine(x, transformation_state_.second_transformation_matrix, transformation_state_.transformation_base);
+        }
+
+        //! Variables transformation method
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            transform_variables_impl(x);
             return x;
         }
 
+        //! The objective transformation penalizes the current variables, so they are always tracked
+        [[nodiscard]] StateTracking minimum_state_tracking() const override { return StateTracking::Full; }
+
         //! Objectives transformation method
         double transform_objectives(const double y) override
         {
@@ -48,6 +82,12 @@ namespace ioh::problem::bbob
         }
 
     public:
+        //! The id of the problem
+        static constexpr int meta_problem_id = 23;
+
+        //! The name of the problem
+        static constexpr const char *meta_name = "Katsuura";
+
         /**
          * @brief Construct a new Katsuura object
          * 
@@ -55,13 +95,10 @@ namespace ioh::problem::bbob
          * @param n_variables the dimension of the problem
          */
         Katsuura(const int instance, const int n_variables) :
-            BBOProblem(23, instance, n_variables, "Katsuura", sqrt(100.0)),
+            BBOProblem(meta_problem_id, instance, n_variables, meta_name, sqrt(100.0)),
             exponent_(10. / pow(static_cast<double>(meta_data_.n_variables), 1.2)),
             factor_(10. / static_cast<double>(meta_data_.n_variables) / static_cast<double>(meta_data_.n_variables))
         {
-            transformation_state_.exponents.resize(33);
-            for (auto i = 1; i < 33; ++i)
-                transformation_state_.exponents[i] = pow(2., static_cast<double>(i));
         }
     };
 }
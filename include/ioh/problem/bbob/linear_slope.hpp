@@ -5,22 +5,35 @@
 namespace ioh::problem::bbob
 {
     //! Linear Slope problem id 5
-    class LinearSlope final : public BBOProblem<LinearSlope>
+    class LinearSlope : public BBOProblem<LinearSlope>
     {
     protected:
-        //! Evaluation method
-        double evaluate(const std::vector<double> &x) override
+        //! Evaluation method, templated on the container type of x
+        template <typename V>
+        double evaluate_impl(const V &x)
         {
             auto result = 0.0;
-            for (auto i = 0; i < meta_data_.n_variables; ++i)
-                result += 5.0 * fabs(transformation_state_.conditions.at(i)) - transformation_state_.conditions.at(i) *
+            for (size_t i = 0; i < x.size(); ++i)
+                result += 5.0 * fabs(transformation_state_.conditions[i]) - transformation_state_.conditions[i] *
                 (
-                    x.at(i) * objective_.x.at(i) < 25.0 ? x.at(i) : objective_.x.at(i)
+                    x[i] * objective_.x[i] < 25.0 ? x[i] : objective_.x[i]
                 );
             return result;
         }
 
+        //! Evaluation method
+        double evaluate(const std::vector<double> &x) override
+        {
+            return evaluate_impl(x);
+        }
+
     public:
+        //! The id of the problem
+        static constexpr int meta_problem_id = 5;
+
+        //! The name of the problem
+        static constexpr const char *meta_name = "LinearSlope";
+
         /**
          * @brief Construct a new Linear Slope object
          * 
@@ -28,7 +41,7 @@ namespace ioh::problem::bbob
          * @param n_variables the dimension of the problem
          */
         LinearSlope(const int instance, const int n_variables) :
-            BBOProblem(5, instance, n_variables, "LinearSlope")
+            BBOProblem(meta_problem_id, instance, n_variables, meta_name)
         {
             static const auto base = sqrt(100.0);
             for (auto i = 0; i < meta_data_.n_variables; ++i)
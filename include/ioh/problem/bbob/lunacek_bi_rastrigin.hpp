@@ -5,38 +5,42 @@
 namespace ioh::problem::bbob
 {
     //! LunacekBiRastrigin problem id 24
-    class LunacekBiRastrigin final : public BBOProblem<LunacekBiRastrigin>
+    class LunacekBiRastrigin : public BBOProblem<LunacekBiRastrigin>
     {
     protected:
-        //! Evaluation method
-        double evaluate(const std::vector<double> &x) override
+        //! Evaluation method, templated on the container type of x
+        template <typename V>
+        double evaluate_impl(const V &x)
         {
             static const auto mu0 = 2.5;
             static const auto d = 1.;
-            const auto double_n = static_cast<double>(meta_data_.n_variables);
+            const auto n = x.size();
+            const auto double_n = static_cast<double>(n);
             const auto s = 1. - 0.5 / (sqrt(double_n + 20) - 4.1);
             const auto mu1 = -sqrt((mu0 * mu0 - d) / s);
 
             auto sum1 = 0., sum2 = 0., sum3 = 0., penalty = 0.;
 
-            std::vector<double> transformation_base(meta_data_.n_variables);
-            std::vector<double> x_hat(meta_data_.n_variables);
-            std::vector<double> z(meta_data_.n_variables);
-
+            // Copies of x are used as buffers, so a fixed size x needs no heap allocation
+            auto transformation_base = x;
+            auto x_hat = x;
+            auto z = x;
+            std::fill(transformation_base.begin(), transformation_base.end(), 0.);
+            std::fill(z.begin(), z.end(), 0.);
 
             /* x_hat */
-            for (auto i = 0; i < meta_data_.n_variables; ++i)
-                x_hat[i] = objective_.x.at(i) > 0. ? 2. * x.at(i) : 2. * x.at(i) * -1;
+            for (size_t i = 0; i < n; ++i)
+                x_hat[i] = objective_.x[i] > 0. ? 2. * x[i] : 2. * x[i] * -1;
              
             /* affine transformation */
-            for (auto i = 0; i < meta_data_.n_variables; ++i)
-                for (auto j = 0; j < meta_data_.n_variables; ++j)
-                    transformation_base[i] += transformation_state_.conditions.at(i)
-                        * transformation_state_.second_rotation.at(i).at(j) * (x_hat.at(j) - mu0);
+            for (size_t i = 0; i < n; ++i)
+                for (size_t j = 0; j < n; ++j)
+                    transformation_base[i] += transformation_state_.conditions[i]
+                        * transformation_state_.second_rotation[i][j] * (x_hat[j] - mu0);
 
-            for (auto i = 0; i < meta_data_.n_variables; ++i)
+            for (size_t i = 0; i < n; ++i)
             {
-                for (auto j = 0; j < meta_data_.n_variables; ++j)
+                for (size_t j = 0; j < n; ++j)
                     z[i] += transformation_state_.first_rotation[i][j] * transformation_base[j];
 
                 const auto out_of_bounds = fabs(x[i]) - 5.0;
@@ -50,7 +54,19 @@ namespace ioh::problem::bbob
             return std::min(sum1, d * double_n + s * sum2) + 10. * (double_n - sum3) + 1e4 * penalty;
         }
 
+        //! Evaluation method
+        double evaluate(const std::vector<double> &x) override
+        {
+            return evaluate_impl(x);
+        }
+
     public:
+        //! The id of the problem
+        static constexpr int meta_problem_id = 24;
+
+        //! The name of the problem
+        static constexpr const char *meta_name = "LunacekBiRastrigin";
+
         /**
          * @brief Construct a new Lunacek Bi Rastrigin object
          * 
@@ -58,7 +74,7 @@ namespace ioh::problem::bbob
          * @param n_variables the dimension of the problem
          */
         LunacekBiRastrigin(const int instance, const int n_variables) :
-            BBOProblem(24, instance, n_variables, "LunacekBiRastrigin")
+            BBOProblem(meta_problem_id, instance, n_variables, meta_name)
         {
             const auto random_normal = common::random::bbob2009::normal(n_variables, transformation_state_.seed);
             for (auto i = 0; i < n_variables; ++i)
@@ -13,14 +13,15 @@ namespace ioh::problem::bbob
     class RastriginBase: public BBOProblem<T>
     {
     protected:
-        //! Evaluation method
-        double evaluate(const std::vector<double> &x) override
+        //! Evaluation method, templated on the container type of x
+        template <typename V>
+        double evaluate_impl(const V &x)
         {
             auto sum1 = 0.0, sum2 = 0.0;
 
             for (const auto xi : x)
             {
-                sum1 += cos(2.0 * IOH_PI * xi);
+                sum1 += common::math::cos(2.0 * IOH_PI * xi);
                 sum2 += xi * xi;
             }
             if (std::isinf(sum2))
@@ -29,14 +30,27 @@ namespace ioh::problem::bbob
             return 10.0 * (static_cast<double>(x.size()) - sum1) + sum2;
         }
 
-        //! Variables transformation method
-        std::vector<double> transform_variables(std::vector<double> x) override
+        //! Evaluation method
+        double evaluate(const std::vector<double> &x) override
+        {
+            return evaluate_impl(x);
+        }
+
+        //! Variables transformation method, templated on the container type of x
+        template <typename V>
+        void transform_variables_impl(V &x)
         {
             using namespace transformation::variables;
             subtract(x, this->objective_.x);
             oscillate(x);
             asymmetric(x, 0.2);
             conditioning(x, 10.0);
+        }
+
+        //! Variables transformation method
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            transform_variables_impl(x);
             return x;
         }
 
@@ -56,9 +70,15 @@ namespace ioh::problem::bbob
     };
 
     //! Rastrigin problem id 3
-    class Rastrigin final: public RastriginBase<Rastrigin>
+    class Rastrigin : public RastriginBase<Rastrigin>
     {
     public:
+        //! The id of the problem
+        static constexpr int meta_problem_id = 3;
+
+        //! The name of the problem
+        static constexpr const char *meta_name = "Rastrigin";
+
         /**
          * @brief Construct a new Rastrigin object
          * 
@@ -66,7 +86,7 @@ namespace ioh::problem::bbob
          * @param n_variables the dimension of the problem 
          */
         Rastrigin(const int instance, const int n_variables) :
-            RastriginBase(3, instance, n_variables, "Rastrigin")
+            RastriginBase(meta_problem_id, instance, n_variables, meta_name)
         {
         }
     };
@@ -5,11 +5,12 @@
 namespace ioh::problem::bbob
 {
     //! Rotated Rastrigin problem id 15
-    class RastriginRotated final : public RastriginBase<RastriginRotated>
+    class RastriginRotated : public RastriginBase<RastriginRotated>
     {
     protected:
-        //! Variables transformation method
-        std::vector<double> transform_variables(std::vector<double> x) override
+        //! Variables transformation method, templated on the container type of x
+        template <typename V>
+        void transform_variables_impl(V &x)
         {
             using namespace transformation::variables;
             subtract(x, objective_.x);
@@ -17,10 +18,22 @@ namespace ioh::problem::bbob
             oscillate(x);
             asymmetric(x, 0.2);
             affine(x, transformation_state_.second_transformation_matrix, transformation_state_.transformation_base);
+        }
+
+        //! Variables transformation method
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            transform_variables_impl(x);
             return x;
         }
 
     public:
+        //! The id of the problem
+        static constexpr int meta_problem_id = 15;
+
+        //! The name of the problem
+        static constexpr const char *meta_name = "RastriginRotated";
+
         /**
          * @brief Construct a new Rastrigin Rotated object
          * 
@@ -28,7 +41,7 @@ namespace ioh::problem::bbob
          * @param n_variables the dimension of the problem
          */
         RastriginRotated(const int instance, const int n_variables) :
-            RastriginBase(15, instance, n_variables, "RastriginRotated")
+            RastriginBase(meta_problem_id, instance, n_variables, meta_name)
         {
         }
     };
@@ -15,25 +15,39 @@ namespace ioh::problem::bbob
         double factor_;
         std::vector<double> negative_one_;
     protected:
-        //! Evaluation method
-        double evaluate(const std::vector<double> &x) override
+        //! Evaluation method, templated on the container type of x
+        template <typename V>
+        double evaluate_impl(const V &x)
         {
             auto sum1 = 0.0, sum2 = 0.0;
 
             for (size_t i = 0; i < x.size() - 1; ++i) {
-                sum1 += pow(x.at(i) * x.at(i) - x.at(i + 1), 2.0);
-                sum2 += pow(x.at(i) - 1.0, 2.0);
+                sum1 += pow(x[i] * x[i] - x[i + 1], 2.0);
+                sum2 += pow(x[i] - 1.0, 2.0);
             }
             return 100.0 * sum1 + sum2 ;
         }
+
+        //! Evaluation method
+        double evaluate(const std::vector<double> &x) override
+        {
+            return evaluate_impl(x);
+        }
         
-        //! Variables transformation method
-        std::vector<double> transform_variables(std::vector<double> x) override
+        //! Variables transformation method, templated on the container type of x
+        template <typename V>
+        void transform_variables_impl(V &x)
         {
             using namespace transformation::variables;
             subtract(x, this->objective_.x);
             scale(x, factor_);
             subtract(x, negative_one_);
+        }
+
+        //! Variables transformation method
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            transform_variables_impl(x);
             return x;
         }
 
@@ -55,9 +69,15 @@ namespace ioh::problem::bbob
 
 
     //! Rosenbrock problem id 8
-    class Rosenbrock final: public RosenbrockBase<Rosenbrock>
+    class Rosenbrock : public RosenbrockBase<Rosenbrock>
     {
     public:
+        //! The id of the problem
+        static constexpr int meta_problem_id = 8;
+
+        //! The name of the problem
+        static constexpr const char *meta_name = "Rosenbrock";
+
         /**
          * @brief Construct a new Rosenbrock object
          * 
@@ -65,7 +85,7 @@ namespace ioh::problem::bbob
          * @param n_variables the dimension of the problem
          */
         Rosenbrock(const int instance, const int n_variables) :
-            RosenbrockBase(8, instance, n_variables, "Rosenbrock")
+            RosenbrockBase(meta_problem_id, instance, n_variables, meta_name)
         {
             for (auto& e : objective_.x)
                 e *= 0.75;
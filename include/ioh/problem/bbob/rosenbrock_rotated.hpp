@@ -6,19 +6,32 @@
 namespace ioh::problem::bbob
 {
     //! Rotated Rosenbrock function 9
-    class RosenbrockRotated final : public RosenbrockBase<RosenbrockRotated>
+    class RosenbrockRotated : public RosenbrockBase<RosenbrockRotated>
     {
     protected:
-        //! Variables transformation method
-        std::vector<double> transform_variables(std::vector<double> x) override
+        //! Variables transformation method, templated on the container type of x
+        template <typename V>
+        void transform_variables_impl(V &x)
         {
             transformation::variables::affine(x,
                 transformation_state_.second_transformation_matrix, 
                 transformation_state_.transformation_base);
+        }
+
+        //! Variables transformation method
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            transform_variables_impl(x);
             return x;
         }
 
     public:
+        //! The id of the problem
+        static constexpr int meta_problem_id = 9;
+
+        //! The name of the problem
+        static constexpr const char *meta_name = "RosenbrockRotated";
+
         /**
          * @brief Construct a new Rosenbrock Rotated object
          * 
@@ -26,7 +39,7 @@ namespace ioh::problem::bbob
          * @param n_variables the dimension of the problem
          */
         RosenbrockRotated(const int instance, const int n_variables) :
-            RosenbrockBase(9, instance, n_variables, "RosenbrockRotated")
+            RosenbrockBase(meta_problem_id, instance, n_variables, meta_name)
         {
             const auto factor = std::max(1.0, std::sqrt(n_variables) / 8.0);
             for (auto i = 0; i < n_variables; ++i)
@@ -16,18 +16,28 @@ namespace ioh::problem::bbob
         //! Condition of the problem
         double condition_;
 
-        //! Evaluation method
-        double evaluate(const std::vector<double> &x) override
+        //! Evaluation method, templated on the container type of x
+        template <typename V>
+        double evaluate_impl(const V &x)
         {
             auto result = 0.0;
-            for (size_t i = 0; i < static_cast<size_t>(this->meta_data_.n_variables) - 1; ++i)
+            for (size_t i = 0; i < x.size() - 1; ++i)
             {
-                const auto z = pow(x.at(i), 2.0) + pow(x.at(i + 1), 2.0);
+                const auto z = pow(x[i], 2.0) + pow(x[i + 1], 2.0);
                 result += pow(z, 0.25) * (1.0 + pow(sin(50.0 * pow(z, 0.1)), 2.0));
             }
-            return pow(result / (static_cast<double>(this->meta_data_.n_variables) - 1.0), 2.0);
+            return pow(result / (static_cast<double>(x.size()) - 1.0), 2.0);
         }
 
+        //! Evaluation method
+        double evaluate(const std::vector<double> &x) override
+        {
+            return evaluate_impl(x);
+        }
+
+        //! The objective transformation penalizes the current variables, so they are always tracked
+        [[nodiscard]] StateTracking minimum_state_tracking() const override { return StateTracking::Full; }
+
         //! Objectives transformation method
         double transform_objectives(const double y) override
         {
@@ -36,8 +46,9 @@ namespace ioh::problem::bbob
             return penalize<double>(this->state_.current.x, this->constraint_, penalty_factor,
                                     shift(y, this->objective_.y));
         }
-        //! Variables transformation method
-        std::vector<double> transform_variables(std::vector<double> x) override
+        //! Variables transformation method, templated on the container type of x
+        template <typename V>
+        void transform_variables_impl(V &x)
         {
             using namespace transformation::variables;
             subtract(x, this->objective_.x);
@@ -46,6 +57,12 @@ namespace ioh::problem::bbob
             asymmetric(x, 0.5);
             affine(x, this->transformation_state_.second_transformation_matrix,
                    this->transformation_state_.transformation_base);
+        }
+
+        //! Variables transformation method
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            transform_variables_impl(x);
             return x;
         }
 
@@ -72,9 +89,15 @@ namespace ioh::problem::bbob
     };
 
     //! Shaffers 10 problem id 17
-    class Schaffers10 final : public Schaffers<Schaffers10>
+    class Schaffers10 : public Schaffers<Schaffers10>
     {
     public:
+        //! The id of the problem
+        static constexpr int meta_problem_id = 17;
+
+        //! The name of the problem
+        static constexpr const char *meta_name = "Schaffers10";
+
         /**
          * @brief Construct a new Schaffers 1 0 object
          * 
@@ -82,7 +105,7 @@ namespace ioh::problem::bbob
          * @param n_variables the dimension of the problem 
          */
         Schaffers10(const int instance, const int n_variables) :
-            Schaffers(17, instance, n_variables, "Schaffers10", 10.0)
+            Schaffers(meta_problem_id, instance, n_variables, meta_name, 10.0)
         {
         }
     };
@@ -5,9 +5,15 @@
 namespace ioh::problem::bbob
 {
     //! Shaffers 1000 problem id 18
-    class Schaffers1000 final: public Schaffers<Schaffers1000>
+    class Schaffers1000 : public Schaffers<Schaffers1000>
     {
     public:
+        //! The id of the problem
+        static constexpr int meta_problem_id = 18;
+
+        //! The name of the problem
+        static constexpr const char *meta_name = "Schaffers1000";
+
         /**
          * @brief Construct a new Schaffers 1 0 0 0 object
          * 
@@ -15,7 +21,7 @@ namespace ioh::problem::bbob
          * @param n_variables the dimension of the problem 
          */
         Schaffers1000(const int instance, const int n_variables) :
-            Schaffers(18, instance, n_variables,  "Schaffers1000", 1000.0)
+            Schaffers(meta_problem_id, instance, n_variables, meta_name, 1000.0)
         {
         }
     };
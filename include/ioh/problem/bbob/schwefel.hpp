@@ -5,14 +5,15 @@
 namespace ioh::problem::bbob
 {
     //! Schefel problem id 20
-    class Schwefel final : public BBOProblem<Schwefel>
+    class Schwefel : public BBOProblem<Schwefel>
 
     {
         std::vector<double> negative_offset_;
         std::vector<double> positive_offset_;
     protected:
-        //! Evaluation method
-        double evaluate(const std::vector<double> &x) override
+        //! Evaluation method, templated on the container type of x
+        template <typename V>
+        double evaluate_impl(const V &x)
         {
             static const auto correction = 418.9828872724339;
             auto result = 0.0;
@@ -26,12 +27,19 @@ namespace ioh::problem::bbob
 
                 result += xi * sin(sqrt(fabs(xi)));
             }
-            result = 0.01 * (penalty + correction - result / static_cast<double>(meta_data_.n_variables));
+            result = 0.01 * (penalty + correction - result / static_cast<double>(x.size()));
             return result;
         }
+
+        //! Evaluation method
+        double evaluate(const std::vector<double> &x) override
+        {
+            return evaluate_impl(x);
+        }
         
-        //! Variables transformation method
-        std::vector<double> transform_variables(std::vector<double> x) override
+        //! Variables transformation method, templated on the container type of x
+        template <typename V>
+        void transform_variables_impl(V &x)
         {
             transformation::variables::random_sign_flip(x, transformation_state_.seed);
             transformation::variables::scale(x, 2);
@@ -40,10 +48,22 @@ namespace ioh::problem::bbob
             transformation::variables::conditioning(x, 10.0);
             transformation::variables::subtract(x, negative_offset_);
             transformation::variables::scale(x, 100);
+        }
+
+        //! Variables transformation method
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            transform_variables_impl(x);
             return x;
         }
 
     public:
+        //! The id of the problem
+        static constexpr int meta_problem_id = 20;
+
+        //! The name of the problem
+        static constexpr const char *meta_name = "Schwefel";
+
         /**
          * @brief Construct a new Schwefel object
          * 
@@ -51,7 +71,7 @@ namespace ioh::problem::bbob
          * @param n_variables the dimension of the problem
          */
         Schwefel(const int instance, const int n_variables) :
-            BBOProblem(20, instance, n_variables, "Schwefel"),
+            BBOProblem(meta_problem_id, instance, n_variables, meta_name),
             negative_offset_(common::random::bbob2009::uniform(n_variables, transformation_state_.seed)),
             positive_offset_(n_variables)
         {
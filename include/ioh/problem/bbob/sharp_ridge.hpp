@@ -6,35 +6,55 @@
 namespace ioh::problem::bbob
 {
     //! Sharp ridge function problem id 13
-    class SharpRidge final : public BBOProblem<SharpRidge>
+    class SharpRidge : public BBOProblem<SharpRidge>
     {
         int n_linear_dimensions_;
     protected:
-        //! Evaluation method
-        double evaluate(const std::vector<double> &x) override
+        //! Evaluation method, templated on the container type of x
+        template <typename V>
+        double evaluate_impl(const V &x)
         {
             static const auto alpha = 100.0;
 
             auto result = 0.0;
-            for (auto i = n_linear_dimensions_; i < meta_data_.n_variables; ++i)
-                result += x.at(i) * x.at(i);
+            for (auto i = static_cast<size_t>(n_linear_dimensions_); i < x.size(); ++i)
+                result += x[i] * x[i];
 
             result = alpha * sqrt(result / n_linear_dimensions_);
             for (auto i = 0; i < n_linear_dimensions_; ++i)
-                result += x.at(i) * x.at(i) / n_linear_dimensions_;
+                result += x[i] * x[i] / n_linear_dimensions_;
 
             return result;
         }
-        //! Variables transformation method
-        std::vector<double> transform_variables(std::vector<double> x) override
+
+        //! Evaluation method
+        double evaluate(const std::vector<double> &x) override
+        {
+            return evaluate_impl(x);
+        }
+        //! Variables transformation method, templated on the container type of x
+        template <typename V>
+        void transform_variables_impl(V &x)
         {
             using namespace transformation::variables;
             subtract(x, objective_.x);
             affine(x, transformation_state_.second_transformation_matrix, transformation_state_.transformation_base);
+        }
+
+        //! Variables transformation method
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            transform_variables_impl(x);
             return x;
         }
 
     public:
+        //! The id of the problem
+        static constexpr int meta_problem_id = 13;
+
+        //! The name of the problem
+        static constexpr const char *meta_name = "SharpRidge";
+
         /**
          * @brief Construct a new Sharp Ridge object
          * 
@@ -42,7 +62,7 @@ namespace ioh::problem::bbob
          * @param n_variables the dimension of the problem 
          */
         SharpRidge(const int instance, const int n_variables) :
-            BBOProblem(13, instance, n_variables, "SharpRidge"),
+            BBOProblem(meta_problem_id, instance, n_variables, meta_name),
         n_linear_dimensions_(static_cast<int>(
             ceil(meta_data_.n_variables <= 40 ? 1 : meta_data_.n_variables / 40.0)))
         {
@@ -4,25 +4,45 @@
 namespace ioh::problem::bbob
 {
     //! Sphere function problem id 1
-    class Sphere final: public BBOProblem<Sphere>
+    class Sphere : public BBOProblem<Sphere>
     {
     protected:
-        //! Evaluation method
-        double evaluate(const std::vector<double>& x) override
+        //! Evaluation method, templated on the container type of x
+        template <typename V>
+        double evaluate_impl(const V &x)
         {
             auto result = 0.0;
             for (const auto xi : x)
                 result += xi * xi;
             return result;
         }
+
+        //! Evaluation method
+        double evaluate(const std::vector<double>& x) override
+        {
+            return evaluate_impl(x);
+        }
         
+        //! Variables transformation method, templated on the container type of x
+        template <typename V>
+        void transform_variables_impl(V &x)
+        {
+            transformation::variables::subtract(x, objective_.x);
+        }
+
         //! Variables transformation method
         std::vector<double> transform_variables(std::vector<double> x) override
         {
-            transformation::variables::subtract(x, objective_.x);
+            transform_variables_impl(x);
             return x;
         }
     public:
+        //! The id of the problem
+        static constexpr int meta_problem_id = 1;
+
+        //! The name of the problem
+        static constexpr const char *meta_name = "Sphere";
+
         /**
          * @brief Construct a new Sphere object
          * 
@@ -30,7 +50,7 @@ namespace ioh::problem::bbob
          * @param n_variables the dimension of the problem
          */
         Sphere(const int instance, const int n_variables) :
-            BBOProblem(1, instance, n_variables, "Sphere")
+            BBOProblem(meta_problem_id, instance, n_variables, meta_name)
         {
         }
     };
@@ -5,49 +5,51 @@
 namespace ioh::problem::bbob
 {   
     //! Step ellipsiod problem id 7
-    class StepEllipsoid final : public BBOProblem<StepEllipsoid>
+    class StepEllipsoid : public BBOProblem<StepEllipsoid>
     {
     protected:
         //! compute project of x
-        double compute_projection(const std::vector<double>& x)
+        template <typename V>
+        double compute_projection(const V& x)
         {
             static const auto alpha = 10.0;
             auto x0 = 0.0;
-            for (auto i = 0; i < meta_data_.n_variables; ++i)
+            for (size_t i = 0; i < x.size(); ++i)
             {
                 transformation_state_.transformation_base[i] = 0.0;
-                for (auto j = 0; j < meta_data_.n_variables; ++j)
-                    transformation_state_.transformation_base[i] += transformation_state_.conditions.at(i)
-                    * transformation_state_.second_rotation.at(i).at(j)
-                    * (x.at(j) - objective_.x.at(j));
+                for (size_t j = 0; j < x.size(); ++j)
+                    transformation_state_.transformation_base[i] += transformation_state_.conditions[i]
+                    * transformation_state_.second_rotation[i][j]
+                    * (x[j] - objective_.x[j]);
 
-                x0 = transformation_state_.transformation_base.at(0);
+                x0 = transformation_state_.transformation_base[0];
 
-                transformation_state_.transformation_base[i] = fabs(transformation_state_.transformation_base.at(i)) > .5
-                    ? floor(transformation_state_.transformation_base.at(i) + .5)
-                    : floor(alpha * transformation_state_.transformation_base.at(i) + .5) / alpha;
+                transformation_state_.transformation_base[i] = fabs(transformation_state_.transformation_base[i]) > .5
+                    ? floor(transformation_state_.transformation_base[i] + .5)
+                    : floor(alpha * transformation_state_.transformation_base[i] + .5) / alpha;
             }
             return x0;
         }
 
-        //! Evaluation method
-        double evaluate(const std::vector<double> &x) override
+        //! Evaluation method, templated on the container type of x
+        template <typename V>
+        double evaluate_impl(const V &x)
         {
             auto result = 0.0;
             auto penalty = 0.0;
             const auto x0 = compute_projection(x);
 
-            for (auto i = 0; i < meta_data_.n_variables; ++i)
+            for (size_t i = 0; i < x.size(); ++i)
             {
-                const auto out_of_bounds = fabs(x.at(i)) - 5.0;
+                const auto out_of_bounds = fabs(x[i]) - 5.0;
                 if (out_of_bounds > 0.0)
                     penalty += out_of_bounds * out_of_bounds;
 
                 auto projection_sum = 0.0;
-                for (auto j = 0; j < meta_data_.n_variables; ++j)
+                for (size_t j = 0; j < x.size(); ++j)
                     projection_sum += transformation_state_.first_rotation[i][j] * transformation_state_.transformation_base[j];
 
-                result += pow(100., transformation_state_.exponents.at(i))
+                result += pow(100., transformation_state_.exponents[i])
                     * projection_sum * projection_sum;
             }
 
@@ -56,6 +58,12 @@ namespace ioh::problem::bbob
             return result;
         }
 
+        //! Evaluation method
+        double evaluate(const std::vector<double> &x) override
+        {
+            return evaluate_impl(x);
+        }
+
         //! Objectives transformation method
         double transform_objectives(const double y) override
         {
@@ -63,6 +71,12 @@ namespace ioh::problem::bbob
         }
 
     public:
+        //! The id of the problem
+        static constexpr int meta_problem_id = 7;
+
+        //! The name of the problem
+        static constexpr const char *meta_name = "StepEllipsoid";
+
         /**
          * @brief Construct a new Step Ellipsoid object
          * 
@@ -70,7 +84,7 @@ namespace ioh::problem::bbob
          * @param n_variables the dimension of the problem
          */
         StepEllipsoid(const int instance, const int n_variables) :
-            BBOProblem(7, instance, n_variables, "StepEllipsoid")
+            BBOProblem(meta_problem_id, instance, n_variables, meta_name)
         {
             static const auto condition = 100.;
             for (auto i = 0; i < meta_data_.n_variables; ++i)
@@ -1,42 +1,78 @@
 #pragma once
 
+#include <array>
+
 #include "bbob_problem.hpp"
 
 namespace ioh::problem::bbob
 {
     //! Weierstrass problem id 16
-    class Weierstrass final : public BBOProblem<Weierstrass>
+    class Weierstrass : public BBOProblem<Weierstrass>
     {
         double f0_;
         double penalty_factor_;
-        std::vector<double> ak_;
-        std::vector<double> bk_;
+        //! The factors 0.5^k of the terms of the series
+        std::array<double, 12> ak_{};
 
     protected:
-        //! Evaluation method
-        double evaluate(const std::vector<double> &x) override
+        //! Evaluation method, templated on the container type of x
+        template <typename V>
+        double evaluate_impl(const V &x)
         {
+            // The terms cos(2 pi (x + 0.5) 3^k) are computed from the point (cos, sin) of the angle for k = 0 on the
+            // unit circle, which is cubed for each next k. Unlike the triple angle formula for the cosine alone, this
+            // does not amplify the rounding errors for angles close to a multiple of pi. The only calls to
+            // transcendental functions are vectorizable, see common::math.
             auto result = 0.0;
-            for (auto i = 0; i < meta_data_.n_variables; ++i)
-                for (size_t j = 0; j < ak_.size(); ++j)
-                    result += cos(2 * IOH_PI * (x.at(i) + 0.5) * bk_.at(j)) * ak_.at(j);
+            for (size_t i = 0; i < x.size(); ++i)
+            {
+                const auto angle = 2 * IOH_PI * (static_cast<double>(x[i]) + 0.5);
+                auto c = common::math::cos(angle);
+                auto s = common::math::sin(angle);
+                auto sum = c;
+                for (size_t k = 1; k < ak_.size(); ++k)
+                {
+                    const auto c2 = c * c;
+                    const auto s2 = s * s;
+                    c = c * (c2 - 3.0 * s2);
+                    s = s * (3.0 * c2 - s2);
+                    sum += ak_[k] * c;
+                }
+                result += sum;
+            }
 
-            result = result / static_cast<double>(meta_data_.n_variables) - f0_;
+            result = result / static_cast<double>(x.size()) - f0_;
             result = 10.0 * pow(result, 3.0);
             return result;
         }
 
-        //! Variables transformation method
-        std::vector<double> transform_variables(std::vector<double> x) override
+        //! Evaluation method
+        double evaluate(const std::vector<double> &x) override
+        {
+            return evaluate_impl(x);
+        }
+
+        //! Variables transformation method, templated on the container type of x
+        template <typename V>
+        void transform_variables_impl(V &x)
         {
             using namespace transformation::variables;
             subtract(x, objective_.x);
             affine(x, transformation_state_.transformation_matrix, transformation_state_.transformation_base);
             oscillate(x);
             affine(x, transformation_state_.second_transformation_matrix, transformation_state_.transformation_base);
+        }
+
+        //! Variables transformation method
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            transform_variables_impl(x);
             return x;
         }
 
+        //! The objective transformation penalizes the current variables, so they are always tracked
+        [[nodiscard]] StateTracking minimum_state_tracking() const override { return StateTracking::Full; }
+
         //! Objectives transformation method
         double transform_objectives(const double y) override
         {
@@ -45,6 +81,12 @@ namespace ioh::problem::bbob
         }
 
     public:
+        //! The id of the problem
+        static constexpr int meta_problem_id = 16;
+
+        //! The name of the problem
+        static constexpr const char *meta_name = "Weierstrass";
+
         /**
          * @brief Construct a new Weierstrass object
          * 
@@ -52,14 +94,13 @@ namespace ioh::problem::bbob
          * @param n_variables the dimension of the problem
          */
         Weierstrass(const int instance, const int n_variables) :
-            BBOProblem(16, instance, n_variables, "Weierstrass", 1 / sqrt(100.0)),
-            f0_(0.0), penalty_factor_(10.0 / n_variables), ak_(12), bk_(12)
+            BBOProblem(meta_problem_id, instance, n_variables, meta_name, 1 / sqrt(100.0)),
+            f0_(0.0), penalty_factor_(10.0 / n_variables)
         {
             for (size_t i = 0; i < ak_.size(); ++i)
             {
                 ak_[i] = pow(0.5, static_cast<double>(i));
-                bk_[i] = pow(3., static_cast<double>(i));
-                f0_ += ak_.at(i) * cos(2 * IOH_PI * bk_.at(i) * 0.5);
+                f0_ += ak_[i] * cos(2 * IOH_PI * pow(3., static_cast<double>(i)) * 0.5);
             }
         }
     };
@@ -0,0 +1,302 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "ioh/common/repr.hpp"
+
+namespace ioh::problem
+{
+    //! How the entries of an \ref EvaluationCache are evicted when it is full
+    enum class CacheEviction
+    {
+        //! The least recently used entry is evicted
+        LRU,
+        //! The CLOCK approximation of LRU, which is cheaper on hits, as entries are not reordered
+        Clock
+    };
+
+    //! How a problem accounts for an evaluation that is answered by its \ref EvaluationCache
+    enum class CacheHits
+    {
+        //! A hit is a regular evaluation: it is counted, updates the state and is logged
+        Counted,
+        //! A hit only returns the value: it is not counted, does not update the state and is not logged
+        Free
+    };
+
+    //! Counters of an \ref EvaluationCache
+    struct CacheStatistics : common::HasRepr
+    {
+        //! Number of lookups that found the point
+        size_t hits = 0;
+
+        //! Number of lookups that did not find the point
+        size_t misses = 0;
+
+        //! Number of entries that were evicted to make room for another
+        size_t evictions = 0;
+
+        //! Number of entries in the cache
+        size_t size = 0;
+
+        //! Maximum number of entries of the cache
+        size_t capacity = 0;
+
+        //! The fraction of the lookups that were hits
+        [[nodiscard]] double hit_rate() const
+        {
+            return hits + misses == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(hits + misses);
+        }
+
+        std::string repr() const override
+        {
+            return fmt::format("<CacheStatistics hits: {} misses: {} evictions: {} size: {} capacity: {}>", hits,
+                               misses, evictions, size, capacity);
+        }
+    };
+
+    /**
+     * @brief A bounded map from search points to their objective values
+     *
+     * The points are packed into 64 bit words, bit strings one bit per variable, and hashed with the lane function
+     * of xxHash64. The entries live in a fixed array of slots, ordered by recency in an intrusive list for LRU
+     * eviction, or swept by a clock hand for CLOCK eviction.
+     *
+     * @tparam T type of the variables
+     */
+    template <typename T>
+    class EvaluationCache
+    {
+    public:
+        //! The cached objective values of a point, before and after the objective transformation
+        struct Values
+        {
+            //! The value returned by evaluate
+            double internal_y;
+
+            //! The value returned by the problem
+            double y;
+        };
+
+    private:
+        //! A packed point
+        using Key = std::vector<uint64_t>;
+
+        //! xxHash64 of the words of a packed point
+        struct KeyHash
+        {
+            static constexpr uint64_t prime1 = 11400714785074694791ull;
+            static constexpr uint64_t prime2 = 14029467366897019727ull;
+            static constexpr uint64_t prime3 = 1609587929392839161ull;
+            static constexpr uint64_t prime4 = 9650029242287828579ull;
+            static constexpr uint64_t prime5 = 2870177450012600261ull;
+
+            static uint64_t rotl(const uint64_t x, const int r) { return (x << r) | (x >> (64 - r)); }
+
+            size_t operator()(const Key &key) const
+            {
+                auto h = prime5 + key.size() * sizeof(uint64_t);
+                for (const auto word : key)
+                {
+                    h ^= rotl(word * prime2, 31) * prime1;
+                    h = rotl(h, 27) * prime1 + prime4;
+                }
+                h ^= h >> 33;
+                h *= prime2;
+                h ^= h >> 29;
+                h *= prime3;
+                h ^= h >> 32;
+                return static_cast<size_t>(h);
+            }
+        };
+
+        using Map = std::unordered_map<Key, uint32_t, KeyHash>;
+
+        //! Marks the absence of a slot in the recency list
+        static constexpr uint32_t none = std::numeric_limits<uint32_t>::max();
+
+        //! An entry of the cache
+        struct Slot
+        {
+            typename Map::iterator entry;
+            Values values;
+            uint32_t prev = none;
+            uint32_t next = none;
+            bool referenced = false;
+        };
+
+        Map map_;
+        std::vector<Slot> slots_;
+        size_t capacity_;
+        CacheEviction eviction_;
+
+        //! Most and least recently used slots, for LRU
+        uint32_t head_ = none, tail_ = none;
+
+        //! The clock hand, for CLOCK
+        uint32_t hand_ = 0;
+
+        CacheStatistics statistics_{};
+
+        //! The key of x, which is reused between lookups
+        Key key_;
+
+        //! Pack x into key_. Bit strings take one bit per variable, other points their bytes, and a last word tells
+        //! which packing was used, so both kinds of keys never collide
+        void pack(const std::vector<T> &x)
+        {
+            key_.clear();
+            if constexpr (std::is_integral_v<T>)
+            {
+                if (std::all_of(x.begin(), x.end(), [](const T xi) { return xi == 0 || xi == 1; }))
+                {
+                    key_.assign((x.size() + 63) / 64, 0);
+                    for (size_t i = 0; i < x.size(); ++i)
+                        key_[i / 64] |= static_cast<uint64_t>(x[i]) << (i % 64);
+                    key_.push_back(0);
+                    return;
+                }
+            }
+            key_.assign((x.size() * sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t), 0);
+            std::memcpy(key_.data(), x.data(), x.size() * sizeof(T));
+            key_.push_back(1);
+        }
+
+        void unlink(const uint32_t i)
+        {
+            auto &slot = slots_[i];
+            (slot.prev == none ? head_ : slots_[slot.prev].next) = slot.next;
+            (slot.next == none ? tail_ : slots_[slot.next].prev) = slot.prev;
+            slot.prev = slot.next = none;
+        }
+
+        void push_front(const uint32_t i)
+        {
+            slots_[i].next = head_;
+            if (head_ != none)
+                slots_[head_].prev = i;
+            head_ = i;
+            if (tail_ == none)
+                tail_ = i;
+        }
+
+        //! Choose the slot to evict
+        uint32_t victim()
+        {
+            if (eviction_ == CacheEviction::LRU)
+                return tail_;
+
+            while (slots_[hand_].referenced)
+            {
+                slots_[hand_].referenced = false;
+                hand_ = static_cast<uint32_t>((hand_ + 1) % slots_.size());
+            }
+            const auto i = hand_;
+            hand_ = static_cast<uint32_t>((hand_ + 1) % slots_.size());
+            return i;
+        }
+
+    public:
+        /**
+         * @brief Construct a new Evaluation Cache object
+         *
+         * @param capacity the maximum number of entries
+         * @param eviction how entries are evicted when the cache is full
+         */
+        explicit EvaluationCache(const size_t capacity, const CacheEviction eviction = CacheEviction::LRU) :
+            capacity_(std::max(capacity, size_t{1})), eviction_(eviction)
+        {
+            map_.reserve(capacity_);
+            slots_.reserve(capacity_);
+            statistics_.capacity = capacity_;
+        }
+
+        //! The slots refer to entries of the map, so a cache cannot be copied
+        EvaluationCache(const EvaluationCache &) = delete;
+
+        //! The slots refer to entries of the map, so a cache cannot be copied
+        EvaluationCache &operator=(const EvaluationCache &) = delete;
+
+        //! Look up the values of x, which counts as a hit or a miss
+        std::optional<Values> find(const std::vector<T> &x)
+        {
+            pack(x);
+            const auto it = map_.find(key_);
+            if (it == map_.end())
+            {
+                statistics_.misses++;
+                return std::nullopt;
+            }
+
+            statistics_.hits++;
+            const auto i = it->second;
+            if (eviction_ == CacheEviction::LRU)
+            {
+                unlink(i);
+                push_front(i);
+            }
+            else
+                slots_[i].referenced = true;
+            return slots_[i].values;
+        }
+
+        //! Store the values of x, evicting an entry if the cache is full
+        void insert(const std::vector<T> &x, const Values values)
+        {
+            pack(x);
+            if (const auto it = map_.find(key_); it != map_.end())
+            {
+                slots_[it->second].values = values;
+                return;
+            }
+
+            uint32_t i;
+            if (slots_.size() < capacity_)
+            {
+                i = static_cast<uint32_t>(slots_.size());
+                slots_.emplace_back();
+            }
+            else
+            {
+                i = victim();
+                map_.erase(slots_[i].entry);
+                if (eviction_ == CacheEviction::LRU)
+                    unlink(i);
+                statistics_.evictions++;
+            }
+
+            slots_[i].entry = map_.emplace(key_, i).first;
+            slots_[i].values = values;
+            slots_[i].referenced = false;
+            if (eviction_ == CacheEviction::LRU)
+                push_front(i);
+        }
+
+        //! Remove all entries and reset the counters
+        void clear()
+        {
+            map_.clear();
+            slots_.clear();
+            head_ = tail_ = none;
+            hand_ = 0;
+            statistics_ = {};
+            statistics_.capacity = capacity_;
+        }
+
+        //! The counters of the cache
+        [[nodiscard]] CacheStatistics statistics() const
+        {
+            auto statistics = statistics_;
+            statistics.size = map_.size();
+            return statistics;
+        }
+    };
+} // namespace ioh::problem
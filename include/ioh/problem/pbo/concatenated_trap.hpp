@@ -58,6 +58,12 @@ namespace ioh
                 }
 
             public:
+                //! The id of the problem
+                static constexpr int meta_problem_id = 24;
+
+                //! The name of the problem
+                static constexpr const char *meta_name = "ConcatenatedTrap";
+
                 /**
                  * \brief Construct a new Concatenated_Trap object. Definition refers to
                  *https://doi.org/10.1007/978-3-030-58115-2_49
@@ -67,7 +73,7 @@ namespace ioh
                  * \param n_variables The dimensionality of the problem to created, 4 by default.
                  **/
                 ConcatenatedTrap(const int instance, const int n_variables) :
-                    PBOProblem(24, instance, n_variables, "ConcatenatedTrap")
+                    PBOProblem(meta_problem_id, instance, n_variables, meta_name)
                 {
                     objective_.x = std::vector<int> (n_variables,1);
                     objective_.y = evaluate(objective_.x);
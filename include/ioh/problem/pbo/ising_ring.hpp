@@ -26,6 +26,12 @@ namespace ioh
                 }
 
             public:
+                //! The id of the problem
+                static constexpr int meta_problem_id = 19;
+
+                //! The name of the problem
+                static constexpr const char *meta_name = "IsingRing";
+
                 /**
                  * \brief Construct a new Ising_Ring object. Definition refers to
                  *https://doi.org/10.1016/j.asoc.2019.106027
@@ -35,7 +41,7 @@ namespace ioh
                  * \param n_variables The dimensionality of the problem to created, 4 by default.
                  **/
                 IsingRing(const int instance, const int n_variables) :
-                    PBOProblem(19, instance, n_variables, "IsingRing")
+                    PBOProblem(meta_problem_id, instance, n_variables, meta_name)
                 {
                     objective_.x = std::vector<int>(n_variables,1);
                     objective_.y = evaluate(objective_.x);
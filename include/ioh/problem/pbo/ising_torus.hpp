@@ -45,6 +45,12 @@ namespace ioh
                 }
 
             public:
+                //! The id of the problem
+                static constexpr int meta_problem_id = 20;
+
+                //! The name of the problem
+                static constexpr const char *meta_name = "IsingTorus";
+
                 /**
                  * \brief Construct a new Ising_Torus object. Definition refers to
                  *https://doi.org/10.1016/j.asoc.2019.106027
@@ -54,7 +60,7 @@ namespace ioh
                  * \param n_variables The dimensionality of the problem to created, 4 by default.
                  **/
                 IsingTorus(const int instance, const int n_variables) :
-                    PBOProblem(20, instance, n_variables, "IsingTorus")
+                    PBOProblem(meta_problem_id, instance, n_variables, meta_name)
                 {
                     objective_.x = std::vector<int>(n_variables,1);
                     objective_.y = evaluate(objective_.x);
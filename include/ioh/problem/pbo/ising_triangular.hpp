@@ -40,6 +40,12 @@ namespace ioh
                 }
 
             public:
+                //! The id of the problem
+                static constexpr int meta_problem_id = 21;
+
+                //! The name of the problem
+                static constexpr const char *meta_name = "IsingTriangular";
+
                 /**
                  * \brief Construct a new Ising_Triangular object. Definition refers to
                  *https://doi.org/10.1016/j.asoc.2019.106027
@@ -49,7 +55,7 @@ namespace ioh
                  * \param n_variables The dimensionality of the problem to created, 4 by default.
                  **/
                 IsingTriangular(const int instance, const int n_variables) :
-                    PBOProblem(21, instance, n_variables, "IsingTriangular")
+                    PBOProblem(meta_problem_id, instance, n_variables, meta_name)
                 {
                     objective_.x = std::vector<int>(n_variables,1);
                     objective_.y = evaluate(objective_.x);
@@ -34,6 +34,12 @@ namespace ioh
                 }
 
             public:
+                //! The id of the problem
+                static constexpr int meta_problem_id = 18;
+
+                //! The name of the problem
+                static constexpr const char *meta_name = "LABS";
+
                 /**
                  * \brief Construct a new LABS object. Definition refers to https://doi.org/10.1016/j.asoc.2019.106027
                  *
@@ -42,7 +48,7 @@ namespace ioh
                  * \param n_variables The dimensionality of the problem to created, 4 by default.
                  **/
                 LABS(const int instance, const int n_variables) : 
-                PBOProblem(18, instance, n_variables, "LABS") {
+                PBOProblem(meta_problem_id, instance, n_variables, meta_name) {
 
                 }
             };
@@ -27,6 +27,12 @@ namespace ioh
                 }
 
             public:
+                //! The id of the problem
+                static constexpr int meta_problem_id = 11;
+
+                //! The name of the problem
+                static constexpr const char *meta_name = "LeadingOnesDummy1";
+
                 /**
                  * \brief Construct a new LeadingOnes_Dummy1 object. Definition refers to
                  *https://doi.org/10.1016/j.asoc.2019.106027
@@ -36,7 +42,7 @@ namespace ioh
                  * \param n_variables The dimensionality of the problem to created, 4 by default.
                  **/
                 LeadingOnesDummy1(const int instance, const int n_variables) :
-                    PBOProblem(11, instance, n_variables, "LeadingOnesDummy1"),
+                    PBOProblem(meta_problem_id, instance, n_variables, meta_name),
                     info_(utils::dummy(n_variables, 0.5, 10000))
                 {
                     objective_.x = std::vector<int>(n_variables,1);
@@ -29,6 +29,12 @@ namespace ioh
                 }
 
             public:
+                //! The id of the problem
+                static constexpr int meta_problem_id = 12;
+
+                //! The name of the problem
+                static constexpr const char *meta_name = "LeadingOnesDummy2";
+
                 /**
                * \brief Construct a new LeadingOnes_Dummy2 object. Definition refers to
                *https://doi.org/10.1016/j.asoc.2019.106027
@@ -38,7 +44,7 @@ namespace ioh
                * \param n_variables The dimensionality of the problem to created, 4 by default.
                **/
                 LeadingOnesDummy2(const int instance, const int n_variables) :
-                    PBOProblem(12, instance, n_variables, "LeadingOnesDummy2"),
+                    PBOProblem(meta_problem_id, instance, n_variables, meta_name),
                     info_(utils::dummy(n_variables, 0.9, 10000))
                 {
                     objective_.x = std::vector<int>(n_variables,1);
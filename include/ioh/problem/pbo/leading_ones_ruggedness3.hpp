@@ -27,6 +27,12 @@ namespace ioh
                 }
 
             public:
+                //! The id of the problem
+                static constexpr int meta_problem_id = 17;
+
+                //! The name of the problem
+                static constexpr const char *meta_name = "LeadingOnesRuggedness3";
+
                 /**
                  * \brief Construct a new LeadingOnes_Ruggedness3 object. Definition refers to
                  *https://doi.org/10.1016/j.asoc.2019.106027
@@ -36,7 +42,7 @@ namespace ioh
                  * \param n_variables The dimensionality of the problem to created, 4 by default.
                  **/
                 LeadingOnesRuggedness3(const int instance, const int n_variables) :
-                    PBOProblem(17, instance, n_variables, "LeadingOnesRuggedness3"),
+                    PBOProblem(meta_problem_id, instance, n_variables, meta_name),
                     info_ (utils::ruggedness3(n_variables))
                 {
                     objective_.x = std::vector<int>(n_variables,1);
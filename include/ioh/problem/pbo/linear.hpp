@@ -23,6 +23,12 @@ namespace ioh
                 }
 
             public:
+                //! The id of the problem
+                static constexpr int meta_problem_id = 3;
+
+                //! The name of the problem
+                static constexpr const char *meta_name = "Linear";
+
                 /**
                  * \brief Construct a new Linear object. Definition refers to https://doi.org/10.1016/j.asoc.2019.106027
                  *
@@ -31,7 +37,7 @@ namespace ioh
                  * \param n_variables The dimensionality of the problem to created, 4 by default.
                  **/
                 Linear(const int instance, const int n_variables) : 
-                PBOProblem(3, instance, n_variables, "Linear") 
+                PBOProblem(meta_problem_id, instance, n_variables, meta_name) 
                 {
                     objective_.x = std::vector<int>(n_variables,1);
                     objective_.y = evaluate(objective_.x);
@@ -51,6 +51,12 @@ namespace ioh
                 }
 
             public:
+                //! The id of the problem
+                static constexpr int meta_problem_id = 22;
+
+                //! The name of the problem
+                static constexpr const char *meta_name = "MIS";
+
                 /**
                  * \brief Construct a new MIS object. Definition refers to https://doi.org/10.1016/j.asoc.2019.106027
                  *
@@ -59,7 +65,7 @@ namespace ioh
                  * \param n_variables The dimensionality of the problem to created, 4 by default.
                  **/
                 MIS(const int instance, const int n_variables) :
-                    PBOProblem(22, instance, n_variables, "MIS"),
+                    PBOProblem(meta_problem_id, instance, n_variables, meta_name),
                     number_of_variables_even_(n_variables % 2 != 0 ? n_variables - 1 : n_variables)
                 {
                     objective_.y = number_of_variables_even_ % 4 == 0
@@ -94,6 +94,12 @@ namespace ioh
                 }
 
             public:
+                //! The id of the problem
+                static constexpr int meta_problem_id = 23;
+
+                //! The name of the problem
+                static constexpr const char *meta_name = "NQueens";
+
                 /**
                  * \brief Construct a new NQueens object. Definition refers to
                  *https://doi.org/10.1016/j.asoc.2019.106027
@@ -103,7 +109,7 @@ namespace ioh
                  * \param n_variables The dimensionality of the problem to created, 4 by default.
                  **/
                 NQueens(const int instance, const int n_variables) : 
-                PBOProblem(23, instance, n_variables, "NQueens") 
+                PBOProblem(meta_problem_id, instance, n_variables, meta_name) 
                 {
                     assert(sqrt(n_variables) - floor(sqrt(n_variables)) == 0);
                     objective_.y = {sqrt(n_variables)};
@@ -1,4 +1,5 @@
 #pragma once
+#include "ioh/common/cache.hpp"
 #include "pbo_problem.hpp"
 
 namespace ioh
@@ -23,6 +24,20 @@ namespace ioh
                         IOH_DBG(error,"NK_Landscapes, k > n")
                         assert(k<=n);
                     }
+
+                    // The tables are cached as n rows of f_, followed by n rows of e_
+                    using common::cache::InstanceCache;
+                    const common::cache::Key key{"nk-landscapes", meta_data_.problem_id, meta_data_.instance, n,
+                                                 {static_cast<double>(k)}};
+                    if (const auto cached = InstanceCache::load(key);
+                        cached && cached->size() == 2 * static_cast<size_t>(n))
+                    {
+                        f_.assign(cached->begin(), cached->begin() + n);
+                        for (auto i = n; i != 2 * n; ++i)
+                            e_.emplace_back((*cached)[i].begin(), (*cached)[i].end());
+                        return;
+                    }
+
                     for (auto i = 0; i != n; ++i)
                     {
                         const auto rand_vec = common::random::pbo::uniform(static_cast<size_t>(k), static_cast<long>(k * (i + 1)));
@@ -57,6 +72,14 @@ namespace ioh
                         f_.emplace_back(common::random::pbo::uniform(static_cast<size_t>(pow(2, k + 1)),
                                                              static_cast<long>(k * (i + 1) * 2)));
                     }
+
+                    if (InstanceCache::enabled())
+                    {
+                        auto sections = f_;
+                        for (const auto &row : e_)
+                            sections.emplace_back(row.begin(), row.end());
+                        InstanceCache::store(key, sections);
+                    }
                 }
             
             protected:
@@ -79,6 +102,12 @@ namespace ioh
                 }
 
             public:
+                //! The id of the problem
+                static constexpr int meta_problem_id = 25;
+
+                //! The name of the problem
+                static constexpr const char *meta_name = "NKLandscapes";
+
                 /**
                  * \brief Construct a new NK_Landscapes object. Definition refers to
                  *https://doi.org/10.1007/978-3-030-58115-2_49
@@ -88,7 +117,7 @@ namespace ioh
                  * \param n_variables The dimensionality of the problem to created, 4 by default.
                  **/
                 NKLandscapes(const int instance, const int n_variables) :
-                    PBOProblem(25, instance, n_variables, "NKLandscapes")
+                    PBOProblem(meta_problem_id, instance, n_variables, meta_name)
                 {
                     set_n_k(n_variables, k_);
                 }
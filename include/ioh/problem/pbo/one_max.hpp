@@ -19,6 +19,12 @@ namespace ioh
                 }
 
             public:
+                //! The id of the problem
+                static constexpr int meta_problem_id = 1;
+
+                //! The name of the problem
+                static constexpr const char *meta_name = "OneMax";
+
                 /**
                  * \brief Construct a new OneMax object. Definition refers to https://doi.org/10.1016/j.asoc.2019.106027
                  *
@@ -27,7 +33,7 @@ namespace ioh
                  * \param n_variables The dimensionality of the problem to created, 4 by default.
                  **/
                 OneMax(const int instance, const int n_variables) :
-                    PBOProblem(1, instance, n_variables, "OneMax")
+                    PBOProblem(meta_problem_id, instance, n_variables, meta_name)
                 {
                     objective_.x = std::vector<int>(n_variables,1);
                     objective_.y = evaluate(objective_.x);
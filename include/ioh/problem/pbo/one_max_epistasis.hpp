@@ -23,6 +23,12 @@ namespace ioh
                 }
 
             public:
+                //! The id of the problem
+                static constexpr int meta_problem_id = 7;
+
+                //! The name of the problem
+                static constexpr const char *meta_name = "OneMaxEpistasis";
+
                 /**
                  * \brief Construct a new OneMax_Epistasis object. Definition refers to
                  *https://doi.org/10.1016/j.asoc.2019.106027
@@ -32,7 +38,7 @@ namespace ioh
                  * \param n_variables The dimensionality of the problem to created, 4 by default.
                  **/
                 OneMaxEpistasis(const int instance, const int n_variables) :
-                    PBOProblem(7, instance, n_variables, "OneMaxEpistasis")
+                    PBOProblem(meta_problem_id, instance, n_variables, meta_name)
                 {
                     objective_.y = {static_cast<double>(n_variables)};
                     objective_.y = transform_objectives(objective_.y);
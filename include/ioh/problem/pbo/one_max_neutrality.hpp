@@ -23,6 +23,12 @@ namespace ioh
                 }
 
             public:
+                //! The id of the problem
+                static constexpr int meta_problem_id = 6;
+
+                //! The name of the problem
+                static constexpr const char *meta_name = "OneMaxNeutrality";
+
                 /**
                  * \brief Construct a new OneMax_Neutrality object. Definition refers to
                  *https://doi.org/10.1016/j.asoc.2019.106027
@@ -32,7 +38,7 @@ namespace ioh
                  * \param n_variables The dimensionality of the problem to created, 4 by default.
                  **/
                 OneMaxNeutrality(const int instance, const int n_variables) :
-                    PBOProblem(6, instance, n_variables, "OneMaxNeutrality")
+                    PBOProblem(meta_problem_id, instance, n_variables, meta_name)
                 {
                     objective_.x = std::vector<int>(n_variables,1);
                     objective_.y = evaluate(objective_.x);
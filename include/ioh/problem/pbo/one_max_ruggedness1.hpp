@@ -22,6 +22,12 @@ namespace ioh
                 }
 
             public:
+                //! The id of the problem
+                static constexpr int meta_problem_id = 8;
+
+                //! The name of the problem
+                static constexpr const char *meta_name = "OneMaxRuggedness1";
+
                 /**
                  * \brief Construct a new OneMax_Ruggedness1 object. Definition refers to
                  *https://doi.org/10.1016/j.asoc.2019.106027
@@ -31,7 +37,7 @@ namespace ioh
                  * \param n_variables The dimensionality of the problem to created, 4 by default.
                  **/
                 OneMaxRuggedness1(const int instance, const int n_variables) :
-                    PBOProblem(8, instance, n_variables, "OneMaxRuggedness1")
+                    PBOProblem(meta_problem_id, instance, n_variables, meta_name)
                 {
                     objective_.x = std::vector<int>(n_variables,1);
                     objective_.y = evaluate(objective_.x);
@@ -23,6 +23,12 @@ namespace ioh
                 }
 
             public:
+                //! The id of the problem
+                static constexpr int meta_problem_id = 10;
+
+                //! The name of the problem
+                static constexpr const char *meta_name = "OneMaxRuggedness3";
+
                 /**
                  * \brief Construct a new OneMax_Ruggedness3 object. Definition refers to
                  *https://doi.org/10.1016/j.asoc.2019.106027
@@ -32,7 +38,7 @@ namespace ioh
                  * \param n_variables The dimensionality of the problem to created, 4 by default.
                  **/
                 OneMaxRuggedness3(const int instance, const int n_variables) :
-                    PBOProblem(10, instance, n_variables, "OneMaxRuggedness3"),
+                    PBOProblem(meta_problem_id, instance, n_variables, meta_name),
                     info_(utils::ruggedness3(n_variables))
                 {
                     objective_.x = std::vector<int>(n_variables,1);
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <optional>
+
 #include "ioh/common/container_utils.hpp"
 #include "ioh/common/factory.hpp"
 #include "ioh/logger/loggers.hpp"
+#include "ioh/problem/memoization.hpp"
 #include "ioh/problem/structures.hpp"
 #include "ioh/problem/utils.hpp"
 
@@ -11,6 +14,9 @@ namespace ioh
     //! Problem namespace
     namespace problem
     {
+        template <typename T>
+        class AsyncEvaluator;
+
         /**
          * @brief Problem Base class
          *
@@ -19,6 +25,8 @@ namespace ioh
         template <typename T>
         class Problem
         {
+            friend class AsyncEvaluator<T>;
+
         protected:
             //! Problem meta data
             MetaData meta_data_;
@@ -38,6 +46,44 @@ namespace ioh
             //! The current log info
             logger::Info log_info_;
 
+            //! The state tracking level requested with \ref set_state_tracking
+            StateTracking state_tracking_ = StateTracking::Full;
+
+            //! The evaluation cache, if memoization is enabled, see \ref enable_memoization
+            std::shared_ptr<EvaluationCache<T>> cache_;
+
+            //! How hits of the evaluation cache are accounted for
+            CacheHits cache_hits_ = CacheHits::Counted;
+
+            //! The maximum number of evaluations, see \ref set_budget
+            int budget_ = std::numeric_limits<int>::max();
+
+            //! The objective value at which the target is reached, if any, see \ref set_target
+            std::optional<double> target_y_;
+
+            //! What the problem does with evaluations after it terminated
+            Termination termination_ = Termination::Flag;
+
+            //! Is the budget spent or the target reached?
+            bool terminated_ = false;
+
+            //! Refuse an evaluation after the problem terminated, unless the termination policy is Flag
+            [[nodiscard]] bool refuse_evaluation() const
+            {
+                if (!terminated_ || termination_ == Termination::Flag)
+                    return false;
+                if (termination_ == Termination::Abort)
+                    throw RunTerminated();
+                return true;
+            }
+
+            //! Check the budget and the target after an evaluation
+            void update_termination()
+            {
+                terminated_ = state_.evaluations >= budget_ ||
+                    (target_y_ && !meta_data_.optimization_type(*target_y_, state_.current_best.y));
+            }
+
             /**
              * @brief Method for checking the input given to the problem has the correct dimension
              *
@@ -107,6 +153,15 @@ namespace ioh
             //! Evaluation function
             [[nodiscard]] virtual double evaluate(const std::vector<T> &x) = 0;
 
+            //! Evaluation function for a batch of transformed points, which evaluates them one by one by default
+            [[nodiscard]] virtual std::vector<double> evaluate_batch(const std::vector<std::vector<T>> &xs)
+            {
+                std::vector<double> ys(xs.size());
+                for (size_t i = 0; i < xs.size(); ++i)
+                    ys[i] = evaluate(xs[i]);
+                return ys;
+            }
+
             //! TODO: check why this is not const
             //! Variables transformation function
             [[nodiscard]] virtual std::vector<T> transform_variables(std::vector<T> x) { return x; }
@@ -114,6 +169,67 @@ namespace ioh
             //! Objectives transformation function
             [[nodiscard]] virtual double transform_objectives(const double y) { return y; }
 
+            //! Can \ref transform_variables and \ref evaluate be called from several threads at once? See \ref
+            //! AsyncEvaluator
+            [[nodiscard]] virtual bool concurrent_evaluation() const { return false; }
+
+            //! The lowest state tracking level at which the problem works, e.g. Full when it reads the current x
+            [[nodiscard]] virtual StateTracking minimum_state_tracking() const { return StateTracking::Evaluations; }
+
+            //! Set the tracking level of the state from the requested one and the needs of the problem and logger
+            void update_state_tracking()
+            {
+                auto tracking = std::max(state_tracking_, minimum_state_tracking());
+                if (target_y_)
+                    tracking = std::max(tracking, StateTracking::Objectives);
+                if (logger_ != nullptr)
+                    tracking = std::max(tracking, logger_->reads_variables() ? StateTracking::Full
+                                                                             : StateTracking::Objectives);
+                state_.tracking = tracking;
+            }
+
+            //! Evaluate x through the evaluation cache, see \ref enable_memoization
+            double evaluate_memoized(const std::vector<T> &x)
+            {
+                const auto values = cache_->find(x);
+                if (values && cache_hits_ == CacheHits::Free)
+                    return values->y;
+
+                if (state_.tracking == StateTracking::Full)
+                    state_.current.x = x;
+
+                if (values)
+                {
+                    if (state_.tracking == StateTracking::Full)
+                        state_.current_internal.x = transform_variables(x);
+                    state_.current_internal.y = values->internal_y;
+                    return update_state();
+                }
+
+                state_.current_internal.x = transform_variables(x);
+                state_.current_internal.y = evaluate(state_.current_internal.x);
+                const auto y = update_state();
+                cache_->insert(x, {state_.current_internal.y, y});
+                return y;
+            }
+
+            //! Transform the evaluated objective value in the current state, then update the state and log it
+            double update_state() { return update_state(transform_objectives(state_.current_internal.y)); }
+
+            //! Update the state with the already transformed objective value y of the current point, and log it
+            double update_state(const double y)
+            {
+                state_.current.y = y;
+                state_.update(meta_data_, objective_);
+                update_termination();
+                if (logger_ != nullptr)
+                {
+                    update_log_info();
+                    logger_->log(log_info());
+                }
+                return state_.current.y;
+            }
+
         public:
             //! The current type held within the instance.
             using Type = T;
@@ -133,7 +249,7 @@ namespace ioh
             {
                 constraint_.check_size(meta_data_.n_variables);
                 log_info_.optimum = objective_.as_double();
-                log_info_.current = state_.current.as_double();
+                log_info_.current = state_.current;
             }
 
             /**
@@ -154,6 +270,7 @@ namespace ioh
             virtual void reset()
             {
                 state_.reset();
+                terminated_ = false;
                 if (logger_ != nullptr)
                 {
                     logger_->reset();
@@ -168,7 +285,7 @@ namespace ioh
                 log_info_.raw_y_best = state_.current_best_internal.y;
                 log_info_.transformed_y = state_.current.y;
                 log_info_.transformed_y_best = state_.current_best.y;
-                log_info_.current = state_.current.as_double();
+                log_info_.current = state_.current;
             }
 
             //! Accessor for current log info
@@ -179,6 +296,7 @@ namespace ioh
             {
                 logger_ = &logger;
                 logger_->attach_problem(meta_data_);
+                update_state_tracking();
             }
 
             //! Dettach a logger
@@ -187,25 +305,189 @@ namespace ioh
                 if (logger_ != nullptr)
                     logger_->reset();
                 logger_ = nullptr;
+                update_state_tracking();
+            }
+
+            /**
+             * @brief Set how much of the evaluated solutions the state keeps track of, see \ref StateTracking
+             *
+             * Below Full, the variables of the current and best solutions are not copied into the state, which saves
+             * O(n) memory traffic per evaluation. The level that is used is raised to what the problem and the
+             * attached logger need: Objectives while a logger is attached, and Full when the logger reads the
+             * variables or the objective transformation of the problem reads the current variables.
+             *
+             * @param tracking the requested tracking level, Full by default
+             */
+            void set_state_tracking(const StateTracking tracking)
+            {
+                state_tracking_ = tracking;
+                update_state_tracking();
+            }
+
+            //! The tracking level that is used by the state
+            [[nodiscard]] StateTracking state_tracking() const { return state_.tracking; }
+
+            /**
+             * @brief Memoize the evaluations of the problem in a bounded cache
+             *
+             * Points that were evaluated before are answered from the cache instead of being evaluated again, which
+             * pays off for expensive problems and for algorithms that often query the same points. The problem must
+             * be deterministic, i.e. its objective value only depends on the point. Enabling memoization again
+             * replaces the cache with an empty one. Batches of points are evaluated point by point while it is
+             * enabled.
+             *
+             * @param capacity the maximum number of cached points
+             * @param eviction how points are evicted when the cache is full
+             * @param hits whether hits are counted as evaluations, update the state and are logged, which is the
+             * default, or are free
+             */
+            void enable_memoization(const size_t capacity, const CacheEviction eviction = CacheEviction::LRU,
+                                    const CacheHits hits = CacheHits::Counted)
+            {
+                cache_ = std::make_shared<EvaluationCache<T>>(capacity, eviction);
+                cache_hits_ = hits;
+            }
+
+            //! Stop memoizing the evaluations, and drop the cache
+            void disable_memoization() { cache_.reset(); }
+
+            /**
+             * @brief Set the maximum number of evaluations of a run
+             *
+             * Once the budget is spent, the problem is \ref terminated, and further evaluations are handled according
+             * to the termination policy, see \ref set_termination.
+             *
+             * @param budget the maximum number of evaluations
+             */
+            void set_budget(const int budget)
+            {
+                budget_ = budget;
+                update_termination();
+            }
+
+            /**
+             * @brief Set the precision at which the target of a run is reached
+             *
+             * The target is reached once the best objective value found is within the precision of the objective
+             * value of the optimum. This requires a problem with a known optimum.
+             *
+             * @param precision the distance to the optimum at which the target is reached
+             */
+            void set_target(const double precision)
+            {
+                set_target_value(meta_data_.optimization_type.type() == common::OptimizationType::Minimization
+                                     ? objective_.y + precision
+                                     : objective_.y - precision);
+            }
+
+            /**
+             * @brief Set the objective value at which the target of a run is reached
+             *
+             * @param y the objective value of the target, or nothing to remove the target
+             */
+            void set_target_value(const std::optional<double> y)
+            {
+                target_y_ = y;
+                update_state_tracking();
+                update_termination();
+            }
+
+            //! The maximum number of evaluations of a run
+            [[nodiscard]] int budget() const { return budget_; }
+
+            //! The objective value at which the target of a run is reached, if any
+            [[nodiscard]] std::optional<double> target_value() const { return target_y_; }
+
+            //! What the problem does when it is evaluated after it terminated
+            [[nodiscard]] Termination termination() const { return termination_; }
+
+            /**
+             * @brief Set what the problem does when it is evaluated after it terminated
+             *
+             * @param termination Flag, the default, evaluates as usual, Refuse returns NaN without counting or logging
+             * the evaluation, and Abort throws \ref RunTerminated
+             */
+            void set_termination(const Termination termination) { termination_ = termination; }
+
+            //! Is the budget spent or the target reached?
+            [[nodiscard]] bool terminated() const { return terminated_; }
+
+            //! The counters of the evaluation cache, all zero when memoization is disabled
+            [[nodiscard]] CacheStatistics memoization_statistics() const
+            {
+                return cache_ != nullptr ? cache_->statistics() : CacheStatistics{};
             }
 
             //! Main call interface
             double operator()(const std::vector<T> &x)
             {
-                if (!check_input(x))
+                if (refuse_evaluation() || !check_input(x))
                     return std::numeric_limits<double>::signaling_NaN();
 
-                state_.current.x = x;
+                if (cache_ != nullptr)
+                    return evaluate_memoized(x);
+
+                if (state_.tracking == StateTracking::Full)
+                    state_.current.x = x;
                 state_.current_internal.x = transform_variables(x);
                 state_.current_internal.y = evaluate(state_.current_internal.x);
-                state_.current.y = transform_objectives(state_.current_internal.y);
-                state_.update(meta_data_, objective_);
-                if (logger_ != nullptr)
+                return update_state();
+            }
+
+            /**
+             * @brief Evaluate a batch of points
+             *
+             * Equivalent to calling the problem on each of the points in turn: the state is updated and logged for
+             * each point, in order. The valid points are transformed, then evaluated together by \ref
+             * evaluate_batch, which problems override when they can evaluate a batch faster than point by point.
+             *
+             * Unless the termination policy is Flag, the points beyond the budget are not evaluated: they are NaN
+             * with Refuse, and Abort throws \ref RunTerminated once the points within the budget are evaluated.
+             *
+             * @param xs the points to evaluate
+             * @return std::vector<double> the objective values of the points, NaN for invalid points
+             */
+            std::vector<double> operator()(const std::vector<std::vector<T>> &xs)
+            {
+                std::vector<double> results(xs.size(), std::numeric_limits<double>::signaling_NaN());
+                if (refuse_evaluation())
+                    return results;
+
+                if (cache_ != nullptr)
                 {
-                    update_log_info();
-                    logger_->log(log_info());
+                    for (size_t i = 0; i < xs.size(); ++i)
+                        results[i] = (*this)(xs[i]);
+                    return results;
                 }
-                return state_.current.y;
+
+                std::vector<size_t> indices;
+                indices.reserve(xs.size());
+                for (size_t i = 0; i < xs.size(); ++i)
+                    if (check_input(xs[i]))
+                        indices.push_back(i);
+
+                const auto n_valid = indices.size();
+                if (termination_ != Termination::Flag)
+                    indices.resize(std::min(n_valid, static_cast<size_t>(budget_ - state_.evaluations)));
+
+                std::vector<std::vector<T>> xs_transformed;
+                xs_transformed.reserve(indices.size());
+                for (const auto i : indices)
+                    xs_transformed.push_back(transform_variables(xs[i]));
+
+                const auto ys = evaluate_batch(xs_transformed);
+                size_t k = 0;
+                for (; k < indices.size() && !(terminated_ && termination_ != Termination::Flag); ++k)
+                {
+                    if (state_.tracking == StateTracking::Full)
+                        state_.current.x = xs[indices[k]];
+                    state_.current_internal.x = std::move(xs_transformed[k]);
+                    state_.current_internal.y = ys[k];
+                    results[indices[k]] = update_state();
+                }
+                if (k < n_valid && termination_ == Termination::Abort)
+                    throw RunTerminated();
+                return results;
             }
 
             //! Accessor for `meta_data_`
@@ -236,6 +518,15 @@ namespace ioh
         template <typename T>
         using ObjectiveFunction = std::function<double(const std::vector<T> &)>;
 
+        /**
+         * @brief typedef for functions which evaluate a batch of points at once, which can be wrapped in \ref
+         * WrappedProblem
+         *
+         * @tparam T type of the problem
+         */
+        template <typename T>
+        using BatchObjectiveFunction = std::function<std::vector<double>(const std::vector<std::vector<T>> &)>;
+
         /**
          * @brief typedef for functions which take a vector and return a transformed version of that vector.
          * Used in WrappedProblem
@@ -315,10 +606,21 @@ namespace ioh
             //! Wrapped objective transformation function
             ObjectiveTransformationFunction transform_objectives_function_;
 
+            //! Wrapped batch objective function, if any
+            BatchObjectiveFunction<T> batch_function_;
+
         protected:
             //! Pass call to wrapped function
             double evaluate(const std::vector<T> &x) override { return function_(x); }
 
+            //! Pass the batch to the wrapped batch function, if any
+            std::vector<double> evaluate_batch(const std::vector<std::vector<T>> &xs) override
+            {
+                if (batch_function_)
+                    return batch_function_(xs);
+                return Problem<T>::evaluate_batch(xs);
+            }
+
             //! Variables transformation function
             std::vector<T> transform_variables(std::vector<T> x) override
             {
@@ -331,6 +633,9 @@ namespace ioh
                 return transform_objectives_function_(y, this->meta_data_.instance);
             }
 
+            //! The wrapped functions are expected to be reentrant
+            [[nodiscard]] bool concurrent_evaluation() const override { return true; }
+
         public:
             /**
              * @brief Construct a new Wrapped Problem object
@@ -347,6 +652,7 @@ namespace ioh
              * @param transform_objectives_function a function which transforms the objective value of the search
              * problem after calling f.
              * @param objective the value for the objective
+             * @param batch_function a function which evaluates a batch of points at once, equivalent to f
              *
              */
             WrappedProblem(
@@ -356,15 +662,144 @@ namespace ioh
                 Constraint<T> constraint = Constraint<T>(),
                 VariablesTransformationFunction<T> transform_variables_function = utils::identity<std::vector<T>, int>,
                 ObjectiveTransformationFunction transform_objectives_function = utils::identity<double, int>,
-                std::optional<Solution<T>> objective = std::nullopt) :
+                std::optional<Solution<T>> objective = std::nullopt,
+                BatchObjectiveFunction<T> batch_function = nullptr) :
                 Problem<T>(MetaData(problem_id, instance_id, name, n_variables, optimization_type), constraint,
                            objective.value_or(Solution<T>(n_variables, optimization_type))),
                 function_(f), transform_variables_function_(transform_variables_function),
-                transform_objectives_function_(transform_objectives_function)
+                transform_objectives_function_(transform_objectives_function),
+                batch_function_(std::move(batch_function))
             {
             }
         };
 
+        /**
+         * @brief A problem which stores the wrapped functions by their own type, rather than as std::function
+         *
+         * The wrapped functions are called directly, so they can be inlined into the evaluation. Through a pointer or
+         * reference to Problem<T>, e.g. a problem created by name from the factory, an evaluation costs a single
+         * virtual call to \ref evaluate. The operator() of InlinedProblem itself makes no indirect calls at all.
+         *
+         * @tparam T type of the problem
+         * @tparam F type of the objective function, callable as double(const std::vector<T> &)
+         * @tparam TX type of the variables transformation function, callable as std::vector<T>(std::vector<T>, int)
+         * @tparam TY type of the objective transformation function, callable as double(double, int)
+         */
+        template <typename T, typename F, typename TX = utils::Identity, typename TY = utils::Identity>
+        class InlinedProblem final : public Problem<T>
+        {
+            //! Wrapped objective function
+            F function_;
+
+            //! Wrapped variables transformation function
+            TX transform_variables_function_;
+
+            //! Wrapped objective transformation function
+            TY transform_objectives_function_;
+
+        protected:
+            //! Pass call to wrapped function
+            double evaluate(const std::vector<T> &x) override { return function_(x); }
+
+            //! Variables transformation function
+            std::vector<T> transform_variables(std::vector<T> x) override
+            {
+                return transform_variables_function_(std::move(x), this->meta_data_.instance);
+            }
+
+            //! Objectives transformation function
+            double transform_objectives(const double y) override
+            {
+                return transform_objectives_function_(y, this->meta_data_.instance);
+            }
+
+            //! The wrapped functions are expected to be reentrant
+            [[nodiscard]] bool concurrent_evaluation() const override { return true; }
+
+        public:
+            using Problem<T>::operator();
+
+            /**
+             * @brief Construct a new Inlined Problem object
+             *
+             * @param f a function to be wrapped
+             * @param name the name of the problem
+             * @param n_variables the dimension of the problem
+             * @param problem_id the problem id
+             * @param instance_id the problem instance
+             * @param optimization_type the type of optimization
+             * @param constraint the contraint for the problem
+             * @param transform_variables_function function which transforms the variables of the search problem
+             * prior to calling f.
+             * @param transform_objectives_function a function which transforms the objective value of the search
+             * problem after calling f.
+             * @param objective the value for the objective
+             */
+            InlinedProblem(F f, const std::string &name, const int n_variables, const int problem_id = 0,
+                           const int instance_id = 0,
+                           const common::OptimizationType optimization_type = common::OptimizationType::Minimization,
+                           Constraint<T> constraint = Constraint<T>(), TX transform_variables_function = TX(),
+                           TY transform_objectives_function = TY(),
+                           std::optional<Solution<T>> objective = std::nullopt) :
+                Problem<T>(MetaData(problem_id, instance_id, name, n_variables, optimization_type), constraint,
+                           objective.value_or(Solution<T>(n_variables, optimization_type))),
+                function_(std::move(f)), transform_variables_function_(std::move(transform_variables_function)),
+                transform_objectives_function_(std::move(transform_objectives_function))
+            {
+            }
+
+            //! Main call interface, which calls the wrapped functions directly
+            double operator()(const std::vector<T> &x)
+            {
+                if (this->cache_ != nullptr || this->terminated_)
+                    return Problem<T>::operator()(x);
+
+                if (!this->check_input(x))
+                    return std::numeric_limits<double>::signaling_NaN();
+
+                if (this->state_.tracking == StateTracking::Full)
+                    this->state_.current.x = x;
+                this->state_.current_internal.x = transform_variables_function_(x, this->meta_data_.instance);
+                this->state_.current_internal.y = function_(this->state_.current_internal.x);
+                return this->update_state(
+                    transform_objectives_function_(this->state_.current_internal.y, this->meta_data_.instance));
+            }
+        };
+
+        namespace detail
+        {
+            //! Include a wrapped function in the factory, see \ref wrap_function
+            template <typename T>
+            void include_wrapped_function(ObjectiveFunction<T> f, BatchObjectiveFunction<T> batch_f,
+                                          const std::string &name, const common::OptimizationType optimization_type,
+                                          const std::optional<T> lb, const std::optional<T> ub,
+                                          std::optional<VariablesTransformationFunction<T>> transform_variables_function,
+                                          std::optional<ObjectiveTransformationFunction> transform_objectives_function,
+                                          std::optional<CalculateObjectiveFunction<T>> calculate_objective)
+            {
+                auto &factory = ProblemFactoryType<Problem<T>>::instance();
+
+                int id = factory.check_or_get_next_available(1, name);
+
+                auto constraint = Constraint<T>(1, lb.value_or(std::numeric_limits<T>::lowest()),
+                                                ub.value_or(std::numeric_limits<T>::max()));
+
+                auto tx = transform_variables_function.value_or(utils::identity<std::vector<T>, int>);
+                auto ty = transform_objectives_function.value_or(utils::identity<double, int>);
+
+                factory.include(name, id,
+                                [f, batch_f, name, id, optimization_type, constraint, tx, ty,
+                                 calculate_objective](const int iid, const int dim) {
+                                    auto objective = calculate_objective ? calculate_objective.value()(iid, dim)
+                                                                         : Solution<T>(dim, optimization_type);
+
+                                    return std::make_unique<WrappedProblem<T>>(f, name, dim, id, iid,
+                                                                               optimization_type, constraint, tx, ty,
+                                                                               objective, batch_f);
+                                });
+            }
+        } // namespace detail
+
         /**
          * @brief Shorthand for wrapping function in a problem.
          *
@@ -389,6 +824,76 @@ namespace ioh
                       std::optional<VariablesTransformationFunction<T>> transform_variables_function = std::nullopt,
                       std::optional<ObjectiveTransformationFunction> transform_objectives_function = std::nullopt,
                       std::optional<CalculateObjectiveFunction<T>> calculate_objective = std::nullopt)
+        {
+            detail::include_wrapped_function<T>(std::move(f), nullptr, name, optimization_type, lb, ub,
+                                                transform_variables_function, transform_objectives_function,
+                                                calculate_objective);
+        }
+
+        /**
+         * @brief Shorthand for wrapping a function that evaluates a batch of points at once in a problem.
+         *
+         * Batches of points, see \ref Problem::operator()(const std::vector<std::vector<T>> &), are passed to f in
+         * a single call, while the state is still updated and logged for each point. A single point is evaluated as
+         * a batch of one point.
+         *
+         * @tparam T type of the problem
+         * @param f a function to be wrapped, which returns the objective values of a batch of points
+         * @param name the name for the new function in the registry
+         * @param optimization_type the type of optimization
+         * @param lb lower bound for the constraint of the problem
+         * @param ub upper bound for the constraint of the problem
+         * @param transform_variables_function function which transforms the variables of the search problem
+         * prior to calling f, for each point.
+         * @param transform_objectives_function a function which transforms the objective value of the search problem
+         * after calling f, for each point.
+         * @param calculate_objective a function which returns the optimum based on a given problem
+         * dimension and instance.
+         */
+        template <typename T>
+        void wrap_batch_function(
+            BatchObjectiveFunction<T> f, const std::string &name,
+            const common::OptimizationType optimization_type = common::OptimizationType::Minimization,
+            const std::optional<T> lb = std::nullopt, const std::optional<T> ub = std::nullopt,
+            std::optional<VariablesTransformationFunction<T>> transform_variables_function = std::nullopt,
+            std::optional<ObjectiveTransformationFunction> transform_objectives_function = std::nullopt,
+            std::optional<CalculateObjectiveFunction<T>> calculate_objective = std::nullopt)
+        {
+            auto single = [f](const std::vector<T> &x) { return f({x}).at(0); };
+            detail::include_wrapped_function<T>(single, std::move(f), name, optimization_type, lb, ub,
+                                                transform_variables_function, transform_objectives_function,
+                                                calculate_objective);
+        }
+
+        /**
+         * @brief Wrap a function in a problem which stores it by its own type, see \ref InlinedProblem.
+         *
+         * Like \ref wrap_function, the problem is included in the factory under the given name, but the evaluation
+         * does not go through std::function. This pays off for objective functions that are cheap to evaluate.
+         *
+         * @tparam T type of the problem
+         * @tparam F type of the objective function
+         * @tparam TX type of the variables transformation function
+         * @tparam TY type of the objective transformation function
+         * @param f a function to be wrapped
+         * @param name the name for the new function in the registry
+         * @param optimization_type the type of optimization
+         * @param lb lower bound for the constraint of the problem
+         * @param ub upper bound for the constraint of the problem
+         * @param transform_variables_function function which transforms the variables of the search problem
+         * prior to calling f.
+         * @param transform_objectives_function a function which transforms the objective value of the search problem
+         * after calling f.
+         * @param calculate_objective a function which returns the optimum based on a given problem
+         * dimension and instance.
+         */
+        template <typename T, typename F, typename TX = utils::Identity, typename TY = utils::Identity>
+        void wrap_inlined_function(F f, const std::string &name,
+                                   const common::OptimizationType optimization_type =
+                                       common::OptimizationType::Minimization,
+                                   const std::optional<T> lb = std::nullopt, const std::optional<T> ub = std::nullopt,
+                                   TX transform_variables_function = TX(), TY transform_objectives_function = TY(),
+                                   std::optional<CalculateObjectiveFunction<T>> calculate_objective = std::nullopt)
         {
             auto &factory = ProblemFactoryType<Problem<T>>::instance();
 
@@ -397,17 +902,14 @@ namespace ioh
             auto constraint = Constraint<T>(1, lb.value_or(std::numeric_limits<T>::lowest()),
                                             ub.value_or(std::numeric_limits<T>::max()));
 
-            auto tx = transform_variables_function.value_or(utils::identity<std::vector<T>, int>);
-            auto ty = transform_objectives_function.value_or(utils::identity<double, int>);
-
             factory.include(name, id,
-                            [f, name, id, optimization_type, constraint, tx, ty, calculate_objective](const int iid,
-                                                                                                      const int dim) {
+                            [f, name, id, optimization_type, constraint, tx = transform_variables_function,
+                             ty = transform_objectives_function, calculate_objective](const int iid, const int dim) {
                                 auto objective = calculate_objective ? calculate_objective.value()(iid, dim)
                                                                      : Solution<T>(dim, optimization_type);
 
-                                return std::make_unique<WrappedProblem<T>>(f, name, dim, id, iid, optimization_type,
-                                                                           constraint, tx, ty, objective);
+                                return std::make_unique<InlinedProblem<T, F, TX, TY>>(
+                                    f, name, dim, id, iid, optimization_type, constraint, tx, ty, objective);
                             });
         }
 
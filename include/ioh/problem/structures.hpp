@@ -1,6 +1,7 @@
 #pragma once
 
 #include <limits>
+#include <stdexcept>
 #include <utility>
 #include <vector>
 
@@ -195,6 +196,39 @@ namespace ioh
         };
 
 
+        /**
+         * @brief How much of the evaluated solutions a \ref State keeps track of
+         *
+         * The levels are ordered, each level tracks everything the previous ones do.
+         */
+        enum class StateTracking
+        {
+            //! Only the number of evaluations, the objective value of the current solution and whether the optimum
+            //! was found
+            Evaluations,
+            //! The objective values of the current and best solutions, but not their variables
+            Objectives,
+            //! The current and best solutions, variables included
+            Full
+        };
+
+        //! What a problem does when it is evaluated after its budget is spent or its target is reached
+        enum class Termination
+        {
+            //! Evaluate as usual, the termination can be checked with Problem::terminated
+            Flag,
+            //! Refuse the evaluation, which returns NaN and is neither counted nor logged
+            Refuse,
+            //! Throw \ref RunTerminated, which aborts the run of the algorithm, see Experimenter
+            Abort
+        };
+
+        //! Thrown by a problem that is evaluated after it terminated, when its termination policy is Abort
+        struct RunTerminated : std::runtime_error
+        {
+            RunTerminated() : std::runtime_error("The budget of the problem is spent or its target is reached") {}
+        };
+
         //! Problem State`
         template <typename T>
         struct State : common::HasRepr
@@ -221,6 +255,9 @@ namespace ioh
             //! Current w. transformations
             Solution<T> current{};
 
+            //! What is tracked by \ref update, the variables of the solutions are only stored for Full
+            StateTracking tracking = StateTracking::Full;
+
             State() = default;
 
             /**
@@ -243,10 +280,25 @@ namespace ioh
             void update(const MetaData &meta_data, const Solution<T> &objective)
             {
                 ++evaluations;
+                if (tracking == StateTracking::Evaluations)
+                {
+                    if (objective.y == current.y)
+                        optimum_found = true;
+                    return;
+                }
+
                 if (meta_data.optimization_type(current.y, current_best.y))
                 {
-                    current_best_internal = current_internal;
-                    current_best = current;
+                    if (tracking == StateTracking::Full)
+                    {
+                        current_best_internal = current_internal;
+                        current_best = current;
+                    }
+                    else
+                    {
+                        current_best_internal.y = current_internal.y;
+                        current_best.y = current.y;
+                    }
 
                     if (objective.y == current.y)
                         optimum_found = true;
@@ -7,7 +7,13 @@
 #include <ioh/common/log.hpp>
 
 #include <fstream>
+#include <future>
 #include <limits>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
 
 #include "ioh/common/log.hpp"
 #include "ioh/problem/problem.hpp"
@@ -35,26 +41,54 @@ namespace ioh
                         eol = 13;
                     return eol;
                 }
-                // Helper: Read instance list from file
-                static std::vector<std::string> read_list_instance(const std::string &path_to_meta_list_instance)
+                // Helper: The non-empty lines of an instance list file, or nullptr if it cannot be read. Each file is
+                // parsed once, and parsed again only when its size or modification time changes
+                static std::shared_ptr<const std::vector<std::string>> instance_list(const std::string &path)
                 {
-                    std::vector<std::string> l{};
-                    std::ifstream list_data(path_to_meta_list_instance);
+                    using Entry = std::pair<std::pair<uintmax_t, fs::file_time_type>,
+                                            std::shared_ptr<const std::vector<std::string>>>;
+                    static std::mutex mutex;
+                    static std::map<std::string, Entry> lists;
+
+                    std::error_code error;
+                    const auto key = fs::absolute(path, error).string();
+                    const auto size = fs::file_size(path, error);
+                    if (error)
+                        return nullptr;
+                    const auto version = std::make_pair(size, fs::last_write_time(path, error));
+                    if (error)
+                        return nullptr;
+
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (const auto it = lists.find(key); it != lists.end() && it->second.first == version)
+                        return it->second.second;
+
+                    std::ifstream list_data(path);
                     if (!list_data)
-                    {
-                        IOH_DBG(warning, fmt::format("Fail to instance list file: {}", path_to_meta_list_instance))
-                        return {};
-                    }
-                    instance_list_path = path_to_meta_list_instance;
-                    char eol = get_eol_in_file(path_to_meta_list_instance);
+                        return nullptr;
+                    auto list = std::make_shared<std::vector<std::string>>();
+                    char eol = get_eol_in_file(path);
                     std::string str{};
                     while (std::getline(list_data, str, eol))
                     {
                         if (str.empty()) // Skip over empty lines
                             continue;
-                        l.push_back(str);
+                        list->push_back(str);
                     }
-                    return l;
+                    lists[key] = {version, list};
+                    return list;
+                }
+                // Helper: Read instance list from file
+                static std::vector<std::string> read_list_instance(const std::string &path_to_meta_list_instance)
+                {
+                    const auto list = instance_list(path_to_meta_list_instance);
+                    if (!list)
+                    {
+                        IOH_DBG(warning, fmt::format("Fail to instance list file: {}", path_to_meta_list_instance))
+                        return {};
+                    }
+                    instance_list_path = path_to_meta_list_instance;
+                    return *list;
                 }
                 // Helper: check if string is double
                 static bool is_double(const std::string &text, double *num = new double())
@@ -100,7 +134,7 @@ namespace ioh
                 double get_chance_cons_factor() const { return chance_cons_factor; }
 
                 // Check if graph is empty
-                bool is_empty() { return n_vertices == 0; }
+                bool is_empty() const { return n_vertices == 0; }
 
                 /**
                  * @brief Read a graph object with optional weights
@@ -266,57 +300,309 @@ namespace ioh
                 // Empty constructor
                 GraphInstance() {}
             };
+            /**
+             * @brief Process-wide registry of the loaded problem instances, such as graphs
+             *
+             * Each instance is loaded once, and shared as an immutable object between all problems that use it. An
+             * instance is released when no problem uses it anymore, except for the `capacity` most recently used
+             * ones, which are kept in memory so consecutive runs on the same instance do not parse it again. The
+             * registry is thread safe. Instances are loaded without holding the lock, so unrelated instances load
+             * concurrently, while concurrent requests for the same instance wait for a single load.
+             *
+             * @tparam Instance the type of the instances
+             * @tparam Key the type that identifies an instance
+             */
+            template <typename Instance, typename Key>
+            class InstanceRegistry
+            {
+                std::mutex mutex_;
+                std::map<Key, std::weak_ptr<const Instance>> instances_;
+                std::list<std::pair<Key, std::shared_ptr<const Instance>>> recent_;
+                std::map<Key, std::shared_future<std::shared_ptr<const Instance>>> loading_;
+                size_t capacity_ = 1;
+
+                InstanceRegistry() = default;
+
+                //! Move the instance to the front of the recently used instances, and release the least recently used ones
+                void touch(const Key &key, const std::shared_ptr<const Instance> &instance)
+                {
+                    recent_.remove_if([&key](const auto &entry) { return entry.first == key; });
+                    recent_.emplace_front(key, instance);
+                    shrink();
+                }
+
+                //! Release the least recently used instances beyond the capacity
+                void shrink()
+                {
+                    while (recent_.size() > capacity_)
+                        recent_.pop_back();
+                    for (auto it = instances_.begin(); it != instances_.end();)
+                        it = it->second.expired() ? instances_.erase(it) : std::next(it);
+                }
+
+            public:
+                InstanceRegistry(const InstanceRegistry &) = delete;
+                InstanceRegistry &operator=(const InstanceRegistry &) = delete;
+
+                //! Accessor to static instance
+                static InstanceRegistry &instance()
+                {
+                    static InstanceRegistry registry;
+                    return registry;
+                }
+
+                /**
+                 * @brief Get an instance, loading it if it is not in memory
+                 *
+                 * @param key the key of the instance
+                 * @param args the arguments of the constructor of Instance, to load it
+                 * @return std::shared_ptr<const Instance> the instance
+                 */
+                template <typename... Args>
+                std::shared_ptr<const Instance> get(const Key &key, Args &&...args)
+                {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    if (const auto it = instances_.find(key); it != instances_.end())
+                    {
+                        if (auto instance = it->second.lock())
+                        {
+                            touch(key, instance);
+                            return instance;
+                        }
+                    }
+
+                    // Wait for the load of another thread, which throws if that load failed
+                    if (const auto it = loading_.find(key); it != loading_.end())
+                    {
+                        const auto loaded = it->second;
+                        lock.unlock();
+                        auto instance = loaded.get();
+                        lock.lock();
+                        touch(key, instance);
+                        return instance;
+                    }
+
+                    std::promise<std::shared_ptr<const Instance>> promise;
+                    loading_.emplace(key, promise.get_future().share());
+                    lock.unlock();
+                    std::shared_ptr<const Instance> instance;
+                    try
+                    {
+                        instance = std::make_shared<const Instance>(std::forward<Args>(args)...);
+                    }
+                    catch (...)
+                    {
+                        promise.set_exception(std::current_exception());
+                        lock.lock();
+                        loading_.erase(key);
+                        throw;
+                    }
+                    promise.set_value(instance);
+                    lock.lock();
+                    loading_.erase(key);
+                    instances_[key] = instance;
+                    touch(key, instance);
+                    return instance;
+                }
+
+                //! Set the number of recently used instances that are kept in memory when no problem uses them
+                void set_capacity(const size_t capacity)
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    capacity_ = capacity;
+                    shrink();
+                }
+
+                //! The number of instances in memory
+                size_t size()
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    shrink();
+                    return instances_.size();
+                }
+
+                //! Release all instances that are not used by a problem
+                void clear()
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    recent_.clear();
+                    shrink();
+                }
+            };
+
+            //! Registry of the graphs, identified by their entry in the instance list, and whether the dimension of
+            //! the problems is given by the edges
+            using GraphRegistry = InstanceRegistry<GraphInstance, std::pair<std::vector<std::string>, bool>>;
+
             //! Graph base class
             class Graph : public Integer
             {
             private:
+                //! The dimension of a problem on the graph
+                static int dimension(const GraphInstance *graph_instance, const bool is_edge)
+                {
+                    if (graph_instance == nullptr)
+                        return 0;
+                    return is_edge ? graph_instance->get_n_edges() : graph_instance->get_n_vertices();
+                }
+
             protected:
-                GraphInstance *graph;
+                //! The graph, shared with the other problems on the same graph
+                std::shared_ptr<const GraphInstance> graph;
                 bool is_initialized;
+                //! The selection of the marginal gain oracle, see \ref add_element
+                std::vector<int> selection_;
+                //! The constraint weight of the selection, without the chance constraint term
+                double selection_cons_weight_ = 0;
+                //! The number of selected elements
+                int selection_size_ = 0;
+                //! The incoming edges of each vertex, as (source, weight) pairs, see \ref incoming_edges
+                std::vector<std::vector<std::pair<int, double>>> incoming_edges_;
+
                 //! Variables transformation method
                 std::vector<int> transform_variables(std::vector<int> x) override { return x; }
                 //! Objectives transformation method
                 double transform_objectives(const double y) override { return y; }
 
+                //! The constraint value of a selection of count elements, including the chance constraint term
+                double constraint_value(const double cons_weight, const int count) const
+                {
+                    return cons_weight + sqrt(count) * graph->get_chance_cons_factor();
+                }
+
+                //! The objective value of a selection, penalized as in evaluate when it violates the constraint
+                double penalized(const double value, const double cons_weight, const int count) const
+                {
+                    const auto cons = constraint_value(cons_weight, count);
+                    return cons > graph->get_cons_weight_limit() ? graph->get_cons_weight_limit() - cons : value;
+                }
+
+                //! Check if vertex is a vertex of the graph, which neighbors in malformed edge files may not be
+                bool is_vertex(const int vertex) const { return vertex >= 0 && vertex < graph->get_n_vertices(); }
+
+                //! The incoming edges of each vertex, built on first use. Both directions of an undirected edge are
+                //! listed, with the weight stored on the side of their source vertex
+                const std::vector<std::vector<std::pair<int, double>>> &incoming_edges()
+                {
+                    if (incoming_edges_.empty() && !is_null())
+                    {
+                        incoming_edges_.resize(graph->get_n_vertices());
+                        for (auto u = 0; u < graph->get_n_vertices(); u++)
+                        {
+                            int subindex = 0;
+                            for (auto v : graph->get_neighbors(u))
+                            {
+                                if (is_vertex(v))
+                                    incoming_edges_[v].emplace_back(u, graph->get_edge_weight(u, subindex));
+                                subindex++;
+                            }
+                        }
+                    }
+                    return incoming_edges_;
+                }
+
+                // Oracle hooks, which problems override to maintain the objective value of the selection
+                // incrementally. The defaults fall back to full evaluations, in which case the gains include the
+                // constraint penalty of evaluate.
+
+                //! Reset the incremental state of the oracle to the empty selection
+                virtual void oracle_reset() {}
+
+                //! Update the incremental state of the oracle, after element was added to or removed from the selection
+                virtual void oracle_update([[maybe_unused]] const int element, [[maybe_unused]] const bool selected) {}
+
+                //! The objective value of the selection, without the constraint penalty
+                virtual double oracle_value() { return evaluate(selection_); }
+
+                //! The change of the objective value when adding element to the selection
+                virtual double oracle_gain(const int element)
+                {
+                    const auto value = oracle_value();
+                    selection_[element] = 1;
+                    const auto gain = evaluate(selection_) - value;
+                    selection_[element] = 0;
+                    return gain;
+                }
+
+                //! Size the selection to the problem, starting from the empty selection, if not done yet
+                void ensure_selection()
+                {
+                    if (selection_.size() != static_cast<size_t>(meta_data_.n_variables))
+                        reset_selection();
+                }
+
+                //! Throw if element is not an element of the selection
+                void check_element(const int element) const
+                {
+                    if (element < 0 || element >= meta_data_.n_variables)
+                        throw std::out_of_range(fmt::format("Element {} is not in [0, {})", element,
+                                                            meta_data_.n_variables));
+                }
+
+                //! The objective value of the selection, as logged by \ref add_element and \ref remove_element.
+                //! Problems whose oracle only estimates the objective evaluate the selection instead
+                virtual double selection_objective() { return selection_value(); }
+
+                //! Add or remove element, then evaluate the selection as a regular, counted and logged evaluation,
+                //! which may be refused after the problem terminated, see \ref set_termination
+                double select(const int element, const bool selected)
+                {
+                    check_element(element);
+                    ensure_selection();
+                    if (refuse_evaluation())
+                        return std::numeric_limits<double>::signaling_NaN();
+
+                    if ((selection_[element] == 1) != selected)
+                    {
+                        selection_[element] = selected;
+                        selection_cons_weight_ += (selected ? 1 : -1) * graph->get_cons_weight(element);
+                        selection_size_ += selected ? 1 : -1;
+                        oracle_update(element, selected);
+                    }
+                    if (state_.tracking == StateTracking::Full)
+                        state_.current.x = selection_;
+                    state_.current_internal.x = selection_;
+                    state_.current_internal.y = selection_objective();
+                    return update_state();
+                }
+
             public:
-                // Read list of graph instances to load, return problem dimension
-                // First, read the meta list of files to load (one entry per line), then read the files
+                // Load a graph instance from the list of graph instances, through the \ref GraphRegistry
+                // First, read the meta list of files to load (one entry per line, see Helper::instance_list), then read the files
                 // Each entry is formatted with {Edge list}|[Edge weights]|[Vertex weights]|[Constraint weights]|[Chance
                 // constraint factor] "NULL" within an entry means no file Chance constraint factor must be in numeric
-                int read_instances_from_files(const int instance, const bool is_edge = false,
-                                              const std::string &path_to_meta_list_graph = Helper::instance_list_path)
+                // Returns nullptr if there is no such instance
+                static std::shared_ptr<const GraphInstance>
+                load_instance(const int instance, const bool is_edge = false,
+                              const std::string &path_to_meta_list_graph = Helper::instance_list_path)
                 {
-                    std::ifstream list_data(path_to_meta_list_graph);
-                    if (!list_data)
+                    const auto list = Helper::instance_list(path_to_meta_list_graph);
+                    if (!list)
                     {
                         IOH_DBG(warning, "Fail to open instance list file: " << path_to_meta_list_graph ); // FIXME raise an exception?
-                        is_initialized = false;
-                        return 0;
+                        return nullptr;
                     }
-                    char eol = Helper::get_eol_in_file(path_to_meta_list_graph);
-                    std::string str{};
-                    auto counter = 0;
-                    while (std::getline(list_data, str, eol))
+                    if (instance < 0 || instance >= static_cast<int>(list->size()))
+                        return nullptr; // No matching instance (e.g. invalid instance)
+
+                    std::vector<std::string> entry(5, "NULL");
+                    std::string rstr;
+                    std::istringstream iss((*list)[instance]);
+                    int index = 0;
+                    while (std::getline(iss, rstr, '|') && index < 5) // File paths are delimited by '|'
                     {
-                        if (str.empty()) // Skip over empty lines
-                            continue;
-                        if (counter++ == instance)
-                        {
-                            std::vector<std::string> entry(5, "NULL");
-                            std::string rstr;
-                            std::istringstream iss(str);
-                            int index = 0;
-                            while (std::getline(iss, rstr, '|') && index < 5) // File paths are delimited by '|'
-                            {
-                                entry[index++] = rstr.c_str();
-                            }
-                            graph = new GraphInstance(entry, is_edge); // Initialize graph instance object
-                            is_initialized = true;
-                            return is_edge ? graph->get_n_edges() : graph->get_n_vertices();
-                        }
+                        entry[index++] = rstr.c_str();
                     }
-                    is_initialized = false;
-                    return 0; // No matching instance (e.g. invalid instance)
+                    return GraphRegistry::instance().get({entry, is_edge}, entry, is_edge);
+                }
+
+                // Replace the graph by an instance from the list of graph instances, return problem dimension
+                int read_instances_from_files(const int instance, const bool is_edge = false,
+                                              const std::string &path_to_meta_list_graph = Helper::instance_list_path)
+                {
+                    graph = load_instance(instance, is_edge, path_to_meta_list_graph);
+                    is_initialized = graph != nullptr;
+                    return dimension(graph.get(), is_edge);
                 }
                 // Check if instance is null
                 bool is_null() { return (!is_initialized) || graph->is_empty(); }
@@ -324,7 +610,7 @@ namespace ioh
                 // Get problem dimension from initialized graph instance
                 int get_dim(const bool is_edge = false)
                 {
-                    return is_null() ? 0 : is_edge ? graph->get_n_edges() : graph->get_n_vertices();
+                    return is_null() ? 0 : dimension(graph.get(), is_edge);
                 }
 
                 /**
@@ -332,15 +618,16 @@ namespace ioh
                  *
                  * @param problem_id The id of the problem
                  * @param instance The instance of the problem
+                 * @param graph_instance the graph, see \ref load_instance, or nullptr if there is no such instance
                  * @param name the name of the problem
                  * @param is_edge whether to define problem dimension with edges or vertices
-                 * @param instance_list_file the name of file containing instance list
                  */
-                Graph(const int problem_id, const int instance, const int n_variables, const std::string &name,
-                      [[maybe_unused]] const bool is_edge, [[maybe_unused]] const std::string &instance_list_file = Helper::instance_list_path) :
-                    Integer(MetaData(problem_id, instance, name, n_variables,
+                Graph(const int problem_id, const int instance, std::shared_ptr<const GraphInstance> graph_instance,
+                      const std::string &name, const bool is_edge) :
+                    Integer(MetaData(problem_id, instance, name, dimension(graph_instance.get(), is_edge),
                                      common::OptimizationType::Maximization),
-                            Constraint<int>(n_variables, 0, 1))
+                            Constraint<int>(dimension(graph_instance.get(), is_edge), 0, 1)),
+                    graph(std::move(graph_instance)), is_initialized(graph != nullptr)
                 {
                     if (is_null())
                     {
@@ -348,6 +635,86 @@ namespace ioh
                         return;
                     }
                 }
+
+                /**
+                 * @name Marginal gain oracle
+                 *
+                 * A stateful interface for greedy algorithms, which maintains a selection of elements (vertices, or
+                 * edges for problems defined on edges), starting from the empty selection. Problems that support it
+                 * update the objective value incrementally, so querying the gain of a candidate costs O(degree)
+                 * rather than a full evaluation. Adding or removing an element is a regular evaluation of the new
+                 * selection, which is counted and logged; a gain query counts as an evaluation, but is not logged.
+                 * Both count against the budget, and are refused like evaluations once the problem terminated.
+                 * Elements out of range throw std::out_of_range.
+                 */
+                ///@{
+
+                //! Reset the selection to the empty selection
+                void reset_selection()
+                {
+                    selection_.assign(meta_data_.n_variables, 0);
+                    selection_cons_weight_ = 0;
+                    selection_size_ = 0;
+                    oracle_reset();
+                }
+
+                //! Add element to the selection, and return the objective value of the new selection
+                double add_element(const int element) { return select(element, true); }
+
+                //! Remove element from the selection, and return the objective value of the new selection
+                double remove_element(const int element) { return select(element, false); }
+
+                //! The gain of the objective value when adding element to the selection, 0 if it is selected already.
+                //! The gain does not include the constraint, see \ref constraint_slack_with
+                double marginal_gain(const int element)
+                {
+                    check_element(element);
+                    ensure_selection();
+                    if (refuse_evaluation())
+                        return std::numeric_limits<double>::signaling_NaN();
+                    state_.evaluations++;
+                    update_termination();
+                    return selection_[element] == 1 ? 0 : oracle_gain(element);
+                }
+
+                //! The objective value of the selection, as it would be evaluated
+                double selection_value()
+                {
+                    ensure_selection();
+                    return penalized(oracle_value(), selection_cons_weight_, selection_size_);
+                }
+
+                //! The constraint slack of the selection, negative if the selection violates the constraint
+                double constraint_slack()
+                {
+                    ensure_selection();
+                    return graph->get_cons_weight_limit() - constraint_value(selection_cons_weight_, selection_size_);
+                }
+
+                //! The constraint slack of the selection after adding element, which must not be selected
+                double constraint_slack_with(const int element)
+                {
+                    check_element(element);
+                    ensure_selection();
+                    return graph->get_cons_weight_limit() -
+                        constraint_value(selection_cons_weight_ + graph->get_cons_weight(element), selection_size_ + 1);
+                }
+
+                //! The current selection, as a 0-1 vector
+                const std::vector<int> &selection()
+                {
+                    ensure_selection();
+                    return selection_;
+                }
+                ///@}
+
+                //! Reset the problem state, and the selection of the oracle
+                void reset() override
+                {
+                    Integer::reset();
+                    if (!selection_.empty())
+                        reset_selection();
+                }
             };
 
             /**
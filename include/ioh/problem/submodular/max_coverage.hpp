@@ -17,10 +17,117 @@ namespace ioh
             {
             private:
                 std::unique_ptr<bool[]> is_covered;
+                std::vector<int> cover_count; // Number of selected vertices covering each vertex, for the oracle
+                double covered_weight = 0; // Weight of the vertices covered by the oracle selection
+                std::vector<int> visit_mark; // Marks the vertices already counted in a gain, by gain query
+                int visit_round = 0;
+                bool incremental = false; // Whether evaluate updates the coverage of the last evaluated solution
+                double max_changed_fraction = 0.1; // Fraction of changed vertices above which evaluate starts over
+                std::vector<int> last_x; // Last evaluated solution, in incremental mode
+                std::vector<int> last_cover_count; // Number of vertices of last_x covering each vertex
+                double last_covered_weight = 0; // Weight of the vertices covered by last_x
+                double last_cons_weight = 0; // Constraint weight of last_x, without the chance constraint term
+                int last_count = 0; // Number of selected vertices in last_x
+                int updates_since_start = 0; // Number of vertices updated since last_x was the empty solution
+                std::vector<int> changed; // Vertices that differ from last_x
+
+                // Reset last_x to the empty solution
+                void reset_incremental()
+                {
+                    std::fill(last_x.begin(), last_x.end(), 0);
+                    std::fill(last_cover_count.begin(), last_cover_count.end(), 0);
+                    last_covered_weight = last_cons_weight = 0;
+                    last_count = updates_since_start = 0;
+                }
+
+                // Apply a function to the vertex and to each of its neighbors
+                template <typename F>
+                void for_closed_neighborhood(const int vertex, F &&f) const
+                {
+                    f(vertex);
+                    for (auto neighbor : graph->get_neighbors(vertex))
+                        if (is_vertex(neighbor))
+                            f(neighbor);
+                }
+
+                // Evaluate by updating last_x for the changed vertices only. The covered weight, the constraint weight
+                // and the count are running sums, updated when a vertex is flipped, or when the cover count of a vertex
+                // in its closed neighborhood goes between 0 and 1. The only pass over all vertices finds the changed
+                // ones, as evaluate receives the whole solution.
+                double evaluate_incremental(const std::vector<int> &x)
+                {
+                    const auto n = graph->get_n_vertices();
+                    changed.clear();
+                    for (auto index = 0; index < n; index++)
+                        if ((x[index] >= 1) != (last_x[index] == 1))
+                            changed.push_back(index);
+
+                    // Start over from the empty solution when many vertices changed. Also start over once as many
+                    // vertices were updated as there are vertices, so the rounding errors of the running sums do not
+                    // accumulate, at an amortized cost of O(1) per update
+                    updates_since_start += static_cast<int>(changed.size());
+                    if (changed.size() > max_changed_fraction * n || updates_since_start > n)
+                    {
+                        reset_incremental();
+                        changed.clear();
+                        for (auto index = 0; index < n; index++)
+                            if (x[index] >= 1)
+                                changed.push_back(index);
+                    }
+                    for (auto index : changed)
+                    {
+                        const auto selected = x[index] >= 1;
+                        last_cons_weight += (selected ? 1 : -1) * graph->get_cons_weight(index);
+                        last_count += selected ? 1 : -1;
+                        for_closed_neighborhood(index, [&](const int vertex) {
+                            if (selected && last_cover_count[vertex]++ == 0)
+                                last_covered_weight += graph->get_vertex_weight(vertex);
+                            else if (!selected && --last_cover_count[vertex] == 0)
+                                last_covered_weight -= graph->get_vertex_weight(vertex);
+                        });
+                        last_x[index] = selected;
+                    }
+                    return penalized(last_covered_weight, last_cons_weight, last_count);
+                }
+
             protected:
+                // Oracle: keep the number of selected vertices covering each vertex
+                void oracle_reset() override
+                {
+                    cover_count.assign(graph->get_n_vertices(), 0);
+                    visit_mark.assign(graph->get_n_vertices(), 0);
+                    covered_weight = 0;
+                }
+                void oracle_update(const int element, const bool selected) override
+                {
+                    for_closed_neighborhood(element, [&](const int vertex) {
+                        if (selected && cover_count[vertex]++ == 0)
+                            covered_weight += graph->get_vertex_weight(vertex);
+                        else if (!selected && --cover_count[vertex] == 0)
+                            covered_weight -= graph->get_vertex_weight(vertex);
+                    });
+                }
+                double oracle_value() override { return covered_weight; }
+                // The weight of the uncovered vertices in the closed neighborhood, each counted once
+                double oracle_gain(const int element) override
+                {
+                    double gain = 0;
+                    visit_round++;
+                    for_closed_neighborhood(element, [&](const int vertex) {
+                        if (cover_count[vertex] == 0 && visit_mark[vertex] != visit_round)
+                        {
+                            visit_mark[vertex] = visit_round;
+                            gain += graph->get_vertex_weight(vertex);
+                        }
+                    });
+                    return gain;
+                }
+
                 // [mandatory] The evaluate method is mandatory to implement
                 double evaluate(const std::vector<int> &x) override
                 {
+                    if (incremental)
+                        return evaluate_incremental(x);
                     std::fill_n(is_covered.get(), graph->get_n_vertices(), false);
                     double result = 0, cons_weight = 0;
                     int index = 0, count = 0;
@@ -55,18 +162,18 @@ namespace ioh
                 }
 
             public:
+                //! The id of the first instance of the problem, under which it is registered
+                static constexpr int meta_problem_id = 1;
+
                 MaxCoverage(const int instance = 1, [[maybe_unused]] const int n_variable = 1,
                             const std::string &instance_file = Helper::instance_list_path.empty()
                                 ? "example_list_maxcoverage"
                                 : Helper::instance_list_path) :
                     GraphProblem(instance, // problem id, starting at 0
                         instance, // the instance id
-                        read_instances_from_files(
-                            instance - 1, false,
-                            instance_file), // n_variables, which is configured by the given instance.
+                        load_instance(instance - 1, false, instance_file), // the graph, shared between problems
                         "MaxCoverage" + std::to_string(instance), // problem name
-                        false, // Using number of edges as dimension or not
-                        instance_file)
+                        false) // Using number of edges as dimension or not
                 {
                     if (is_null())
                     {
@@ -77,6 +184,23 @@ namespace ioh
                     objective_.x = std::vector<int>(graph->get_n_vertices(), 1);
                     objective_.y = evaluate(objective_.x);
                 }
+                /**
+                 * @brief Set whether evaluate updates the coverage of the last evaluated solution, rather than
+                 * computing it from scratch, which is faster when successive solutions differ in a few vertices. The
+                 * value is then a running sum, which may differ from a full evaluation by rounding errors
+                 *
+                 * @param enabled whether to evaluate incrementally, disabled by default
+                 * @param changed_fraction the fraction of changed vertices above which the coverage is computed from
+                 * scratch, as updating it would cost more than a full pass
+                 */
+                void set_incremental_evaluation(const bool enabled, const double changed_fraction = 0.1)
+                {
+                    incremental = enabled && !is_null();
+                    max_changed_fraction = changed_fraction;
+                    last_x.assign(incremental ? graph->get_n_vertices() : 0, 0);
+                    last_cover_count.assign(incremental ? graph->get_n_vertices() : 0, 0);
+                    reset_incremental();
+                }
                 // Constructor without n_variable, swap argument positions to avoid ambiguity
                 MaxCoverage(const std::string &instance_file = Helper::instance_list_path, const int instance = 1) :
                     MaxCoverage(instance, 1, instance_file)
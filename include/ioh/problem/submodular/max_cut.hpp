@@ -15,7 +15,41 @@ namespace ioh
             // Description: refer to Evolutionary Submodular Optimization website at https://cs.adelaide.edu.au/~optlog/CompetitionESO2022.php
             class MaxCut final : public GraphProblem<MaxCut>
             {
+            private:
+                double cut_value = 0; // Objective value of the oracle selection
+
+                // Change of the objective value when vertex joins the selection, the rest of the selection unchanged
+                double cut_delta(const int vertex)
+                {
+                    const auto is_digraph = graph->get_is_digraph();
+                    double delta = 0;
+                    int subindex = 0;
+                    for (auto neighbor : graph->get_neighbors(vertex))
+                    { // Outgoing edges enter the cut if the neighbor is not selected, and leave the negative cut
+                      // of a digraph if it is
+                        if (neighbor != vertex && is_vertex(neighbor) && (selection_[neighbor] == 0 || is_digraph))
+                            delta += graph->get_edge_weight(vertex, subindex);
+                        subindex++;
+                    }
+                    for (const auto &[source, weight] : incoming_edges()[vertex])
+                    { // Incoming edges leave the cut if the source is selected, and enter the negative cut of a
+                      // digraph if it is not
+                        if (source != vertex && (selection_[source] == 1 || is_digraph))
+                            delta -= weight;
+                    }
+                    return delta;
+                }
+
             protected:
+                // Oracle: keep the cut value of the selection, updated by the delta of each change
+                void oracle_reset() override { cut_value = 0; }
+                void oracle_update(const int element, const bool selected) override
+                {
+                    cut_value += selected ? cut_delta(element) : -cut_delta(element);
+                }
+                double oracle_value() override { return cut_value; }
+                double oracle_gain(const int element) override { return cut_delta(element); }
+
                 // [mandatory] The evaluate method is mandatory to implement
                 double evaluate(const std::vector<int> &x) override
                 {
@@ -59,17 +93,17 @@ namespace ioh
                 }
 
             public:
+                //! The id of the first instance of the problem, under which it is registered
+                static constexpr int meta_problem_id = 2000001;
+
                 MaxCut(const int instance = 1, [[maybe_unused]] const int n_variable = 1,
                        const std::string &instance_file = Helper::instance_list_path.empty() ? "example_list_maxcut"
                            : Helper::instance_list_path) :
                     GraphProblem(instance + 2000000, // problem id, starting at 2000000
                         instance, // the instance id
-                        read_instances_from_files(
-                            instance - 1, false,
-                            instance_file), // dimensions
+                        load_instance(instance - 1, false, instance_file), // the graph, shared between problems
                         "MaxCut" + std::to_string(instance), // problem name
-                        false, // Using number of edges as dimension or not
-                        instance_file)
+                        false) // Using number of edges as dimension or not
                 {
                     if (is_null())
                     {
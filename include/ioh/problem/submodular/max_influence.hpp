@@ -1,7 +1,9 @@
 // Author: Viet Anh Do
 
 #pragma once
+#include <algorithm>
 #include <queue>
+#include <random>
 #include <stdexcept>
 #include <ioh/common/log.hpp>
 #include "graph_problem.hpp"
@@ -56,7 +58,92 @@ namespace ioh
                     return total;
                 }
 
+                int rr_sets_count = 10000; // Number of reverse reachable sets of the oracle
+                std::vector<std::vector<int>> rr_sets; // Vertices of each reverse reachable set
+                std::vector<std::vector<int>> rr_sets_of_vertex; // Reverse reachable sets containing each vertex
+                std::vector<int> rr_set_hits; // Number of selected vertices in each reverse reachable set
+                int rr_sets_covered = 0; // Number of reverse reachable sets containing a selected vertex
+                double total_vertex_weight = 0;
+
+                // Sample the reverse reachable sets: the vertices that activate a root in a random realization of the
+                // Independent Cascade Model, with the root drawn proportionally to the vertex weights. The sample only
+                // depends on the instance and the number of sets, not on the global random generator
+                void sample_rr_sets()
+                {
+                    std::mt19937 engine(static_cast<unsigned int>(meta_data_.instance));
+                    std::uniform_real_distribution<double> uniform;
+                    const auto n = graph->get_n_vertices();
+                    const auto &incoming = incoming_edges();
+                    std::vector<double> cumulative_weights(n);
+                    total_vertex_weight = 0;
+                    for (auto i = 0; i < n; i++)
+                        cumulative_weights[i] = total_vertex_weight += graph->get_vertex_weight(i);
+
+                    rr_sets.assign(rr_sets_count, {});
+                    rr_sets_of_vertex.assign(n, {});
+                    std::fill_n(is_activated.get(), n, false);
+                    for (auto set = 0; set < rr_sets_count; set++)
+                    {
+                        const auto root = static_cast<int>(std::min<std::ptrdiff_t>(
+                            std::upper_bound(cumulative_weights.begin(), cumulative_weights.end(),
+                                             uniform(engine) * total_vertex_weight) -
+                                cumulative_weights.begin(),
+                            n - 1));
+                        auto &members = rr_sets[set];
+                        members.push_back(root);
+                        is_activated[root] = true;
+                        for (size_t visit = 0; visit < members.size(); visit++) // Reverse BFS
+                        {
+                            for (const auto &[source, probability] : incoming[members[visit]])
+                            {
+                                if (!is_activated[source] && uniform(engine) <= probability)
+                                {
+                                    is_activated[source] = true;
+                                    members.push_back(source);
+                                }
+                            }
+                        }
+                        for (auto vertex : members)
+                        {
+                            is_activated[vertex] = false;
+                            rr_sets_of_vertex[vertex].push_back(set);
+                        }
+                    }
+                }
+
             protected:
+                // Oracle: estimate the spread with reverse reachable sets, i.e. the total vertex weight times the
+                // fraction of the sets that contain a selected vertex. Unlike evaluate, the estimate is deterministic
+                // for a given sample, so the gains are consistent between queries. The estimate is not the objective
+                // value though: add_element and remove_element evaluate the selection with the Monte-Carlo
+                // simulations of evaluate, as the other evaluations, see selection_objective
+                void oracle_reset() override
+                {
+                    if (static_cast<int>(rr_sets.size()) != rr_sets_count)
+                        sample_rr_sets();
+                    rr_set_hits.assign(rr_sets.size(), 0);
+                    rr_sets_covered = 0;
+                }
+                void oracle_update(const int element, const bool selected) override
+                {
+                    for (auto set : rr_sets_of_vertex[element])
+                    {
+                        if (selected && rr_set_hits[set]++ == 0)
+                            rr_sets_covered++;
+                        else if (!selected && --rr_set_hits[set] == 0)
+                            rr_sets_covered--;
+                    }
+                }
+                double oracle_value() override { return total_vertex_weight * rr_sets_covered / rr_sets_count; }
+                double oracle_gain(const int element) override
+                {
+                    int uncovered = 0;
+                    for (auto set : rr_sets_of_vertex[element])
+                        uncovered += rr_set_hits[set] == 0;
+                    return total_vertex_weight * uncovered / rr_sets_count;
+                }
+                double selection_objective() override { return evaluate(selection_); }
+
                 // [mandatory] The evaluate method is mandatory to implement
                 double evaluate(const std::vector<int> &x) override
                 {
@@ -85,17 +172,18 @@ namespace ioh
                 }
 
             public:
+                //! The id of the first instance of the problem, under which it is registered
+                static constexpr int meta_problem_id = 1000001;
+
                 MaxInfluence(const int instance = 1, [[maybe_unused]] const int n_variables = 1,
                              const std::string &instance_file = Helper::instance_list_path.empty()
                                  ? "example_list_maxinfluence"
                                  : Helper::instance_list_path) :
                     GraphProblem(instance + 1000000, // problem id, starting at 1000000
                                  instance, // the instance id
-                                 read_instances_from_files(instance - 1, false,
-                                                           instance_file), // dimensions
+                                 load_instance(instance - 1, false, instance_file), // the graph, shared between problems
                                  "MaxInfluence" + std::to_string(instance), // problem name
-                                 false, // Using number of edges as dimension or not
-                                 instance_file)
+                                 false) // Using number of edges as dimension or not
                 {
                     if (is_null())
                     {
@@ -113,6 +201,15 @@ namespace ioh
                 }
                 // Set number of times to repeat simulation, must be at least 1
                 void set_simulation_reps(const int new_reps) { simulation_reps = std::max(new_reps, 1); }
+                // Set number of reverse reachable sets sampled by the marginal gain oracle, must be at least 1. This
+                // resets the selection of the oracle
+                void set_rr_sets(const int new_count)
+                {
+                    rr_sets_count = std::max(new_count, 1);
+                    rr_sets.clear();
+                    if (!selection_.empty())
+                        reset_selection();
+                }
             };
         } // namespace submodular
     } // namespace problem
@@ -1,11 +1,14 @@
 // Author: Viet Anh Do
 
 #pragma once
+#include <chrono>
 #include <fstream>
 #include <stdexcept>
+#include <ioh/common/cache.hpp>
 #include <ioh/common/log.hpp>
 #include <ioh/problem/problem.hpp>
 #include <ioh/problem/transformation.hpp>
+#include "graph_problem.hpp"
 
 namespace ioh
 {
@@ -14,62 +17,53 @@ namespace ioh
         namespace submodular
 
         {
-            // Packing While Travelling
-            // Description: refer to Evolutionary Submodular Optimization website at https://cs.adelaide.edu.au/~optlog/CompetitionESO2022.php
-            class PackWhileTravel final : public Integer
+            /**
+             * @brief A Packing While Travelling instance, converted from a TTP file
+             *
+             * The items are stored in contiguous arrays, sorted by city, so the evaluation streams through them. The
+             * parsed instance can be stored in the \ref common::cache::InstanceCache, which is checked before parsing
+             * the TTP file again.
+             */
+            class PackWhileTravelInstance
             {
-                int n_items;
-                double velocity_gap, velocity_max, capacity, penalty;
-                std::vector<double> *distances;
-                std::vector<std::vector<double>> *weights, *profits;
-                std::vector<std::vector<int>> *index_map;
-                bool is_initialized;
-
-                // Read TTP instance from file, convert to PWT instance, return problem dimension
-                int read_instance_by_id(const int instance, const std::string &instance_list_file)
+                // Read TTP file, convert to PWT instance, return false if the file is malformed
+                bool read_ttp(const std::string &ttp_file)
                 {
-                    if (!is_null()) // If already initialized, skip reading file
-                        return n_items;
-                    is_initialized = false;
-                    std::vector<std::string> instance_list = Helper::read_list_instance(instance_list_file);
-                    if (static_cast<int>(instance_list.size()) <= instance || instance < 0) // If instance id is invalid,
-                                               // return a valid dummy size
-                        return 1;
-                    std::ifstream ttp_data(instance_list[instance]);
+                    std::ifstream ttp_data(ttp_file);
                     if (!ttp_data)
-                        throw std::invalid_argument("Fail to open instance file: " + (instance_list[instance]));
-                    char eol = Helper::get_eol_in_file(instance_list[instance]);
+                        throw std::invalid_argument("Fail to open instance file: " + ttp_file);
+                    char eol = Helper::get_eol_in_file(ttp_file);
                     std::string str, tstr;
                     int index_line = 0;
                     while (std::getline(ttp_data, str, eol) && index_line++ < 2); // Skip 2 lines, to line 3
                     int n_cities; // Number of locations
                     if (!Helper::is_int(str.substr(str.find_last_of(':') + 1), &n_cities)){
                         IOH_DBG(warning, "Cannot read number of cities for PWT"); // FIXME raise an exception?
-                        return 1; // return a valid dummy size
+                        return false;
                     }
                     std::getline(ttp_data, str, eol); // Number of items
                     if (!Helper::is_int(str.substr(str.find_last_of(':') + 1), &n_items))
                     {
                         IOH_DBG(warning, "Cannot read number of items for PWT"); // FIXME raise an exception?
-                        return 1; // return a valid dummy size
+                        return false;
                     }
                     std::getline(ttp_data, str, eol); // Carry capacity
                     if (!Helper::is_double(str.substr(str.find_last_of(':') + 1), &capacity))
                     {
                         IOH_DBG(warning, "Cannot read carry capacity for PWT"); // FIXME raise an exception?
-                        return 1; // return a valid dummy size
+                        return false;
                     }
                     std::getline(ttp_data, str, eol); // Minimum velocity
                     if (!Helper::is_double(str.substr(str.find_last_of(':') + 1), &velocity_gap))
                     {
                         IOH_DBG(warning, "Cannot read minimum velocity for PWT"); // FIXME raise an exception?
-                        return 1; // return a valid dummy size
+                        return false;
                     }
                     std::getline(ttp_data, str, eol); // Maximum velocity
                     if (!Helper::is_double(str.substr(str.find_last_of(':') + 1), &velocity_max))
                     {
                         IOH_DBG(warning, "Cannot read maximum velocity for PWT"); // FIXME raise an exception?
-                        return 1; // return a valid dummy size
+                        return false;
                     }
                     velocity_gap = velocity_max - velocity_gap;
                     std::getline(ttp_data, str, eol);
@@ -77,7 +71,7 @@ namespace ioh
                     if (!Helper::is_double(str.substr(str.find_last_of(':') + 1), &rent_ratio))
                     {
                         IOH_DBG(warning, "Cannot read rent ratio for PWT"); // FIXME raise an exception?
-                        return 1; // return a valid dummy size
+                        return false;
                     }
                     while (std::getline(ttp_data, str, eol) && index_line++ < 5) // Skip 2 lines, to line 11
                         ;
@@ -87,16 +81,13 @@ namespace ioh
                         !Helper::is_double(str.substr(second_space + 1), &init_y))
                     {
                         IOH_DBG(warning, "Cannot read coordinates for PWT"); // FIXME raise an exception?
-                        return 1; // return a valid dummy size
+                        return false;
                     }
                     cur_x = init_x;
                     cur_y = init_y;
                     index_line = 0;
                     penalty = 0;
-                    distances = new std::vector<double>();
-                    weights = new std::vector<std::vector<double>>();
-                    profits = new std::vector<std::vector<double>>();
-                    index_map = new std::vector<std::vector<int>>();
+                    distances.reserve(std::max(n_cities, 0));
                     while (std::getline(ttp_data, str, eol) && index_line++ < n_cities - 1) // Read until next header
                     {// Populate route distances and compute penalty term
                         first_space = str.find_first_of('	'), second_space = str.find_last_of('	');
@@ -105,56 +96,176 @@ namespace ioh
                             !Helper::is_double(str.substr(second_space + 1), &next_y))
                         {
                             IOH_DBG(warning,  "Cannot read coordinates for PWT" )
-                            return 1; // return a valid dummy size
+                            return false;
                         }
                         distance =
                             std::ceil(std::sqrt(std::pow(next_x - cur_x, 2) + std::pow(next_y - cur_y, 2))); // CEIL_2D
-                        distances->push_back(distance);
+                        distances.push_back(distance);
                         penalty -= distance;
                         cur_x = next_x;
                         cur_y = next_y;
                     } // End reading location coordinates
                     distance =
                         std::ceil(std::sqrt(std::pow(init_x - cur_x, 2) + std::pow(init_y - cur_y, 2))); // CEIL_2D
-                    distances->push_back(distance);
+                    distances.push_back(distance);
                     penalty =
                         (penalty - distance) * rent_ratio / (velocity_max - velocity_gap); // Complete penalty term
+
+                    // Read item data in file order, then sort the items by city, keeping the file order per city
+                    std::vector<int> item_cities;
+                    item_cities.reserve(std::max(n_items, 0));
+                    item_profits.reserve(std::max(n_items, 0));
+                    item_weights.reserve(std::max(n_items, 0));
                     index_line = 0;
                     while (std::getline(ttp_data, str, eol) && index_line < n_items)// Read item data
                     {
                         tstr = str.substr(str.find_first_of('	') + 1);
                         first_space = tstr.find_first_of('	');
                         second_space = tstr.find_last_of('	');
-                        int city_index = std::stoi(tstr.substr(second_space + 1)) - 1;
-                        while (static_cast<int>(weights->size()) <= city_index)
-                        {
-                            weights->push_back({});
-                            profits->push_back({});
-                            index_map->push_back({});
-                        }
-                        (*index_map)[city_index].push_back(index_line++);
+                        item_cities.push_back(std::stoi(tstr.substr(second_space + 1)) - 1);
+                        index_line++;
                         double temp;
                         if (Helper::is_double(tstr.substr(0, first_space), &temp))
                         {
-                            (*profits)[city_index].push_back(temp);
+                            item_profits.push_back(temp);
                         }
                         else
                         {
                             IOH_DBG(warning,  "Cannot read item profits for PWT" )
-                            return 1; // return a valid dummy size
+                            return false;
                         }
                         if (Helper::is_double(tstr.substr(first_space + 1, second_space - first_space - 1), &temp))
                         {
-                            (*weights)[city_index].push_back(temp);
+                            item_weights.push_back(temp);
                         }
                         else
                         {
                             IOH_DBG(warning,  "Cannot read item weights for PWT" )
-                            return 1; // return a valid dummy size
+                            return false;
                         }
                     }
-                    is_initialized = true;
-                    return n_items; // Dimension is number of items
+                    sort_items_by_city(item_cities);
+                    return true;
+                }
+
+                // Counting sort of the items read so far by city, which sets the city offsets
+                void sort_items_by_city(const std::vector<int> &item_cities)
+                {
+                    const auto n_item_cities =
+                        item_cities.empty() ? 0 : *std::max_element(item_cities.begin(), item_cities.end()) + 1;
+                    city_offsets.assign(n_item_cities + 1, 0);
+                    for (auto city : item_cities)
+                        city_offsets[city + 1]++;
+                    for (auto city = 0; city < n_item_cities; city++)
+                        city_offsets[city + 1] += city_offsets[city];
+
+                    auto next = std::vector<int>(city_offsets.begin(), city_offsets.end() - 1);
+                    std::vector<double> weights(item_cities.size()), profits(item_cities.size());
+                    item_index.resize(item_cities.size());
+                    for (size_t item = 0; item < item_cities.size(); item++)
+                    {
+                        const auto position = next[item_cities[item]]++;
+                        weights[position] = item_weights[item];
+                        profits[position] = item_profits[item];
+                        item_index[position] = static_cast<int>(item);
+                    }
+                    item_weights = std::move(weights);
+                    item_profits = std::move(profits);
+                }
+
+                // The key of the parsed file in the instance cache, which changes with the file
+                static common::cache::Key cache_key(const std::string &ttp_file)
+                {
+                    std::error_code error;
+                    const auto size = fs::file_size(ttp_file, error);
+                    const auto modified = fs::last_write_time(ttp_file, error);
+                    auto path = fs::canonical(ttp_file, error);
+                    if (error)
+                        path = fs::absolute(ttp_file);
+                    auto path_hash = uint64_t{14695981039346656037ull};
+                    for (const auto c : path.string())
+                        path_hash = (path_hash ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+                    return {"pack-while-travel", 0, 0, 0,
+                            {static_cast<double>(path_hash >> 11), static_cast<double>(size),
+                             std::chrono::duration<double>(modified.time_since_epoch()).count()}};
+                }
+
+                // Read the parsed file from the instance cache, return false if it is not there
+                bool load_cached(const common::cache::Key &key)
+                {
+                    const auto cached = common::cache::InstanceCache::load(key);
+                    if (!cached || cached->size() != 6 || (*cached)[0].size() != 5)
+                        return false;
+                    const auto &scalars = (*cached)[0];
+                    n_items = static_cast<int>(scalars[0]);
+                    capacity = scalars[1];
+                    velocity_gap = scalars[2];
+                    velocity_max = scalars[3];
+                    penalty = scalars[4];
+                    distances = (*cached)[1];
+                    city_offsets.assign((*cached)[2].begin(), (*cached)[2].end());
+                    item_weights = (*cached)[3];
+                    item_profits = (*cached)[4];
+                    item_index.assign((*cached)[5].begin(), (*cached)[5].end());
+                    return true;
+                }
+
+            public:
+                int n_items = 0;
+                double velocity_gap = 0, velocity_max = 0, capacity = 0, penalty = 0;
+                std::vector<double> distances{}; // Distance from each city to the next one on the route
+                std::vector<int> city_offsets{}; // The items of city i are in [city_offsets[i], city_offsets[i + 1])
+                std::vector<double> item_weights{}; // Weights of the items, sorted by city
+                std::vector<double> item_profits{}; // Profits of the items, sorted by city
+                std::vector<int> item_index{}; // Index of the items in the solution, sorted by city
+
+                // Check if instance is empty, i.e. the file is malformed
+                bool is_empty() const { return distances.empty(); }
+
+                // Number of cities with items, i.e. up to the last city with items
+                int get_n_item_cities() const { return static_cast<int>(city_offsets.size()) - 1; }
+
+                /**
+                 * @brief Read a Packing While Travelling instance from a TTP file, or from the instance cache
+                 *
+                 * @param ttp_file name of the TTP file
+                 */
+                explicit PackWhileTravelInstance(const std::string &ttp_file)
+                {
+                    const auto key = cache_key(ttp_file);
+                    if (load_cached(key))
+                        return;
+                    if (!read_ttp(ttp_file))
+                    {
+                        distances.clear();
+                        return;
+                    }
+                    if (common::cache::InstanceCache::enabled())
+                        common::cache::InstanceCache::store(
+                            key,
+                            {{static_cast<double>(n_items), capacity, velocity_gap, velocity_max, penalty},
+                             distances,
+                             {city_offsets.begin(), city_offsets.end()},
+                             item_weights,
+                             item_profits,
+                             {item_index.begin(), item_index.end()}});
+                }
+            };
+
+            //! Registry of the Packing While Travelling instances, identified by the canonical path of their TTP file
+            using PackWhileTravelRegistry = InstanceRegistry<PackWhileTravelInstance, std::string>;
+
+            // Packing While Travelling
+            // Description: refer to Evolutionary Submodular Optimization website at https://cs.adelaide.edu.au/~optlog/CompetitionESO2022.php
+            class PackWhileTravel final : public Integer
+            {
+                std::shared_ptr<const PackWhileTravelInstance> data; // The instance, shared with the other problems
+                bool is_initialized;
+
+                // The dimension of the problem on an instance, a valid dummy size if there is no valid instance
+                static int dimension(const PackWhileTravelInstance *instance)
+                {
+                    return instance == nullptr || instance->is_empty() ? 1 : instance->n_items;
                 }
 
             protected:
@@ -165,74 +276,104 @@ namespace ioh
                 // [mandatory] The evaluate method is mandatory to implement
                 double evaluate(const std::vector<int> &x) override
                 {
+                    const auto capacity = data->capacity, velocity_max = data->velocity_max,
+                               velocity_gap = data->velocity_gap;
+                    const auto *offsets = data->city_offsets.data();
+                    const auto *weights = data->item_weights.data();
+                    const auto *profits = data->item_profits.data();
+                    const auto *index = data->item_index.data();
+                    const auto *distances = data->distances.data();
                     double profit_sum = 0, cons = 0, time = 0;
-                    for (size_t i = 0; i < weights->size(); i++)
-                    {
-                        for (size_t j = 0; j < (*weights)[i].size(); j++)
+                    for (auto i = 0; i < data->get_n_item_cities(); i++)
+                    { // A single pass through the items sorted by city, with the prefix weight in cons
+                        for (auto j = offsets[i]; j < offsets[i + 1]; j++)
                         {
-                            if (x[(*index_map)[i][j]] >= 1)
+                            if (x[index[j]] >= 1)
                             {
-                                cons += (*weights)[i][j];
-                                profit_sum += (*profits)[i][j];
+                                cons += weights[j];
+                                profit_sum += profits[j];
                             }
                         }
                         if (cons > capacity) // Assuming weights are non-negative
                             continue; // Keep adding weights, but ignore time to avoid division by 0
-                        time += (*distances)[i] / (velocity_max - (velocity_gap * cons / capacity));
+                        time += distances[i] / (velocity_max - (velocity_gap * cons / capacity));
                     }
                     if (cons > capacity)
-                        return capacity - cons + penalty;
+                        return capacity - cons + data->penalty;
                     return profit_sum - time;
                 }
 
             public:
+                // Load an instance from the list of TTP files, through the \ref PackWhileTravelRegistry
+                // Returns nullptr if there is no such instance
+                static std::shared_ptr<const PackWhileTravelInstance>
+                load_instance(const int instance, const std::string &instance_list_file)
+                {
+                    std::vector<std::string> instance_list = Helper::read_list_instance(instance_list_file);
+                    if (static_cast<int>(instance_list.size()) <= instance || instance < 0)
+                        return nullptr;
+                    return load_file(instance_list[instance]);
+                }
+
+                // Load an instance from its TTP file, through the \ref PackWhileTravelRegistry, which identifies it by
+                // its canonical path, so that different paths to the same file share the instance
+                static std::shared_ptr<const PackWhileTravelInstance> load_file(const std::string &ttp_file)
+                {
+                    std::error_code error;
+                    const auto path = fs::canonical(ttp_file, error);
+                    return PackWhileTravelRegistry::instance().get(error ? ttp_file : path.string(), ttp_file);
+                }
+
                 // Check if instance is null
-                bool is_null() { return !distances || (!is_initialized) || distances->empty(); }
+                bool is_null() { return (!is_initialized) || data->is_empty(); }
 
                 // Get problem dimension from initialized instance
-                int get_dim() { return is_null() ? 0 : n_items; }
+                int get_dim() { return is_null() ? 0 : data->n_items; }
 
-                // Constructor
-                PackWhileTravel(const int instance = 1, [[maybe_unused]] const int n_variables = 1,
-                                const std::string &instance_list_file = Helper::instance_list_path.empty()
-                                    ? "example_list_pwt"
-                                    : Helper::instance_list_path) :
+                /**
+                 * @brief Construct a new PackWhileTravel object on a loaded instance
+                 *
+                 * @param instance The instance of the problem
+                 * @param pwt_instance the data, see \ref load_instance, or nullptr if there is no such instance
+                 */
+                PackWhileTravel(const int instance, std::shared_ptr<const PackWhileTravelInstance> pwt_instance) :
                     Integer(MetaData(instance + 3000000,// problem id, starting at 3000000
                         instance, "PackWhileTravel" + std::to_string(instance),
-                        read_instance_by_id(instance - 1, instance_list_file), // n_variables will be updated based on the given instance.
-                        // n_variables,
+                        dimension(pwt_instance.get()), // n_variables will be updated based on the given instance.
                         common::OptimizationType::Maximization),
-                        Constraint<int>(read_instance_by_id(instance - 1, instance_list_file), 0, 1)
-                    )
+                        Constraint<int>(dimension(pwt_instance.get()), 0, 1)
+                    ),
+                    data(std::move(pwt_instance)), is_initialized(data != nullptr)
                 {
                     if (is_null())
                     {
                         IOH_DBG(warning, "Instance not created properly (e.g. invalid id)."); // FIXME raise an exception?
                         return;
                     }
-                    if (velocity_gap >= velocity_max || velocity_gap <= 0 || velocity_max <= 0)
+                    if (data->velocity_gap >= data->velocity_max || data->velocity_gap <= 0 || data->velocity_max <= 0)
                         throw std::invalid_argument(
                             "Minimum velocity must be positive and smaller than maximum velocity");
-                    if (capacity <= 0)
+                    if (data->capacity <= 0)
                         throw std::invalid_argument("Capacity must be positive");
-                    if (weights->size() != profits->size() || weights->size() != distances->size())
+                    if (data->get_n_item_cities() != static_cast<int>(data->distances.size()))
                         throw std::invalid_argument("Weights, profits, and number of cities don't match");
-                    for (size_t i = 0; i < weights->size(); i++)
+                    for (size_t j = 0; j < data->item_weights.size(); j++)
                     {
-                        if ((*weights)[i].size() != (*profits)[i].size())
-                            throw std::invalid_argument("Weights and profits don't match");
-                    }
-                    for (size_t i = 0; i < weights->size(); i++)
-                    {
-                        for (size_t j = 0; j < (*weights)[i].size(); j++)
-                        {
-                            if ((*weights)[i][j] < 0 || (*profits)[i][j] < 0)
-                                throw std::invalid_argument("Weights and profits must be non-negative");
-                        }
+                        if (data->item_weights[j] < 0 || data->item_profits[j] < 0)
+                            throw std::invalid_argument("Weights and profits must be non-negative");
                     }
                     objective_.x = std::vector<int>(meta_data_.n_variables, 1);
                     objective_.y = evaluate(objective_.x);
                 }
+
+                // Constructor
+                PackWhileTravel(const int instance = 1, [[maybe_unused]] const int n_variables = 1,
+                                const std::string &instance_list_file = Helper::instance_list_path.empty()
+                                    ? "example_list_pwt"
+                                    : Helper::instance_list_path) :
+                    PackWhileTravel(instance, load_instance(instance - 1, instance_list_file))
+                {
+                }
                 // Constructor without n_variable, swap argument positions to avoid ambiguity
                 PackWhileTravel(const std::string &instance_file = Helper::instance_list_path, const int instance = 1) :
                     PackWhileTravel(instance, 1, instance_file)
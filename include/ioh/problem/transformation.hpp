@@ -1,5 +1,6 @@
 #pragma once
 
+#include "ioh/common/math.hpp"
 #include "ioh/problem/utils.hpp"
 #include "ioh/problem/structures.hpp"
 
@@ -34,20 +35,23 @@ namespace ioh::problem::transformation
 
         /**
          * \brief oscillates the value for y
+         *
+         * Computed in double precision with the branch-free functions of \ref common::math, so a loop over this
+         * function can be vectorized. pow(exp(a), factor) is computed as exp(factor * a).
          * \param y the raw y value
          * \param factor the factor of oscillation
          * \return the transformed y value
          */
-        inline double oscillate(const double y, const double factor = 0.1)
+        template <typename T>
+        IOH_MATH_INLINE T oscillate(const T y, const double factor = 0.1)
         {
-            if (y != 0.0)
-            {
-                const auto log_y = log(fabs(y)) / factor;
-                if (y > 0)
-                    return pow(exp(log_y + 0.49 * (sin(log_y) + sin(0.79 * log_y))), factor);
-                return -pow(exp(log_y + 0.49 * (sin(0.55 * log_y) + sin(0.31 * log_y))), factor);
-            }
-            return y;
+            const auto yd = static_cast<double>(y);
+            const auto positive = yd > 0.0;
+            const auto log_y = common::math::log(std::fabs(yd)) / factor;
+            const auto a = log_y + 0.49 * (common::math::sin((positive ? 1.0 : 0.55) * log_y) +
+                                           common::math::sin((positive ? 0.79 : 0.31) * log_y));
+            const auto result = common::math::exp(factor * a);
+            return static_cast<T>(yd == 0.0 ? yd : (positive ? result : -result));
         }
 
         using Transformation = std::function<double(double, double)>;
@@ -183,15 +187,16 @@ namespace ioh::problem::transformation
          * \param m transformation matrix
          * \param b transformation vector
          */
-        inline void affine(std::vector<double> &x, const std::vector<std::vector<double>> &m,
-                           const std::vector<double> &b)
+        template <typename V>
+        void affine(V &x, const std::vector<std::vector<double>> &m, const std::vector<double> &b)
         {
-            auto temp_x = x;
+            const auto temp_x = x;
             for (size_t i = 0; i < x.size(); ++i)
             {
-                x[i] = b[i];
+                auto sum = b[i];
                 for (size_t j = 0; j < x.size(); ++j)
-                    x[i] += temp_x[j] * m[i][j];
+                    sum += temp_x[j] * m[i][j];
+                x[i] = sum;
             }
         }
 
@@ -200,12 +205,18 @@ namespace ioh::problem::transformation
          * \param x raw variables
          * \param beta scale of the transformation
          */
-        inline void asymmetric(std::vector<double> &x, const double beta)
+        template <typename V>
+        void asymmetric(V &x, const double beta)
         {
             const auto n_eff = static_cast<double>(x.size()) - 1.0;
-            for (auto i = 0; i < static_cast<int>(x.size()); ++i)
-                if (x[i] > 0.0)
-                    x[i] = pow(x[i], 1.0 + beta * i / n_eff * sqrt(x[i]));
+            for (size_t i = 0; i < x.size(); ++i)
+            {
+                // Branch-free, so the loop can be vectorized
+                const auto xi = static_cast<double>(x[i]);
+                const auto positive = xi > 0.0;
+                const auto exponent = 1.0 + beta * static_cast<double>(i) / n_eff * std::sqrt(positive ? xi : 0.0);
+                x[i] = static_cast<std::decay_t<decltype(x[i])>>(positive ? common::math::pow(xi, exponent) : xi);
+            }
         }
 
 
@@ -213,7 +224,8 @@ namespace ioh::problem::transformation
          * \brief brs transformation on x
          * \param x raw variables
          */
-        inline void brs(std::vector<double> &x)
+        template <typename V>
+        void brs(V &x)
         {
             const auto n_eff = static_cast<double>(x.size()) - 1.0;
             for (auto i = 0; i < static_cast<int>(x.size()); ++i)
@@ -230,7 +242,8 @@ namespace ioh::problem::transformation
          * \param x raw variables
          * \param alpha base of the transformation
          */
-        inline void conditioning(std::vector<double> &x, const double alpha)
+        template <typename V>
+        void conditioning(V &x, const double alpha)
         {
             const auto n_eff = static_cast<double>(x.size()) - 1.0;
             for (auto i = 0; i < static_cast<int>(x.size()); ++i)
@@ -242,7 +255,8 @@ namespace ioh::problem::transformation
          * \param x raw variables
          * \param alpha  the factor of oscillation
          */
-        inline void oscillate(std::vector<double> &x, const double alpha = 0.1)
+        template <typename V>
+        void oscillate(V &x, const double alpha = 0.1)
         {
             for (auto &xi : x)
                 xi = objective::oscillate(xi, alpha);
@@ -254,7 +268,8 @@ namespace ioh::problem::transformation
          * \param x raw variables
          * \param scalar the factor to scale x by
          */
-        inline void scale(std::vector<double> &x, const double scalar)
+        template <typename V>
+        void scale(V &x, const double scalar)
         {
             for (auto &xi : x)
                 xi = scalar * xi;
@@ -265,7 +280,8 @@ namespace ioh::problem::transformation
          * \param x raw variables
          * \param offset a vector of offsets for each xi
          */
-        inline void subtract(std::vector<double> &x, const std::vector<double> &offset)
+        template <typename V>
+        void subtract(V &x, const std::vector<double> &offset)
         {
             for (auto i = 0; i < static_cast<int>(x.size()); ++i)
                 x[i] = x[i] - offset[i];
@@ -276,7 +292,8 @@ namespace ioh::problem::transformation
          * \param x raw variables
          * \param seed for generating the random vector
          */
-        inline void random_sign_flip(std::vector<double> &x, const long seed)
+        template <typename V>
+        void random_sign_flip(V &x, const long seed)
         {
             const auto random_numbers = common::random::bbob2009::uniform(x.size(), seed);
             for (size_t i = 0; i < x.size(); ++i)
@@ -289,7 +306,8 @@ namespace ioh::problem::transformation
          * \param x the raw variables
          * \param xopt the optimum
          */
-        inline void z_hat(std::vector<double> &x, const std::vector<double> &xopt)
+        template <typename V>
+        void z_hat(V &x, const std::vector<double> &xopt)
         {
             const auto temp_x = x;
             for (size_t i = 1; i < x.size(); ++i)
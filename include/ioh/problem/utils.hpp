@@ -357,6 +357,17 @@ namespace ioh
             template<typename T, typename... Args>
             T identity(T p, Args &&...) {return p;}
 
+            //! Function object which forwards its first argument, which can be inlined where \ref identity cannot
+            struct Identity
+            {
+                //! Forward p
+                template <typename T, typename... Args>
+                T operator()(T p, Args &&...) const
+                {
+                    return p;
+                }
+            };
+
         } // namespace utils
     } // namespace problem
 } // namespace ioh
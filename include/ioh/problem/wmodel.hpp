@@ -3,4 +3,4 @@
 #include "wmodel/wmodel_problem.hpp"
 #include "wmodel/wmodel_leading_ones.hpp"
 #include "wmodel/wmodel_one_max.hpp"
-
+#include "wmodel/wmodel_template.hpp"
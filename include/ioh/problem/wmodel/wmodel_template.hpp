@@ -0,0 +1,155 @@
+#pragma once
+
+#include <stdexcept>
+
+#include "wmodel_leading_ones.hpp"
+#include "wmodel_one_max.hpp"
+
+namespace ioh::problem::wmodel
+{
+    /**
+     * @brief Compile-time configured WModel problem.
+     *
+     * Evaluates the same layers as the runtime configured \ref WModel, but with the layer configuration given as
+     * template parameters. Disabled layers are removed at compile time, and a fixed neutrality and epistasis block
+     * size allows the compiler to unroll the per block loops. Intermediate bit strings are kept in buffers owned by
+     * the problem, so no allocation happens during evaluation.
+     *
+     * For any configuration, the objective values are identical to those of the runtime configured `Base` class.
+     *
+     * @tparam Base the base WModel problem, i.e. \ref WModelOneMax or \ref WModelLeadingOnes
+     * @tparam Dummy whether the dummy (redundancy) layer is enabled, the select rate is given to the constructor
+     * @tparam Mu the neutrality parameter, 0 disables the neutrality layer
+     * @tparam Nu the epistasis block size, 0 disables the epistasis layer
+     * @tparam Gamma the ruggedness parameter, 0 disables the ruggedness layer
+     */
+    template <typename Base, bool Dummy, int Mu, int Nu, int Gamma>
+    class WModelT final : public Base
+    {
+        static_assert(std::is_base_of_v<WModel, Base>, "Base should be a WModel problem");
+        static_assert(Mu >= 0 && Nu >= 0 && Gamma >= 0, "WModel layer parameters should be non-negative");
+
+        //! Buffer for the output of the dummy layer
+        std::vector<int> dummy_x_;
+
+        //! Buffer for the output of the neutrality and epistasis layers
+        std::vector<int> layer_x_;
+
+        //! Neutrality layer with a fixed block size Mu
+        static void neutrality(const std::vector<int> &x, std::vector<int> &out)
+        {
+            constexpr auto threshold = (Mu >> 1) + (Mu & 1);
+            for (size_t j = 0, i = 0; j < out.size(); ++j, i += Mu)
+            {
+                auto ones = 0;
+                for (auto k = 0; k < Mu; ++k)
+                    ones += static_cast<int>(x[i + k] == 1);
+                out[j] = static_cast<int>(ones >= threshold);
+            }
+        }
+
+        /**
+         * @brief In-place epistasis of a single block with a fixed size N.
+         *
+         * Equivalent to \ref utils::base_epistasis called with the same vector as input and output, which is how the
+         * runtime WModel applies this layer. The parity of the block is updated incrementally, which reduces the cost
+         * per block from O(N^2) to O(N).
+         */
+        template <int N>
+        static void epistasis_block(int *block)
+        {
+            const auto flip = block[0];
+            auto parity = 0;
+            for (auto j = 1; j < N; ++j)
+                parity ^= block[j];
+
+            for (auto i = N - 1; i >= 0; --i)
+            {
+                const auto skip = (i + 1) % N;
+                const auto result = flip ^ parity ^ (skip != 0 ? block[skip] : 0);
+                if (i != 0)
+                    parity ^= block[i] ^ result;
+                block[i] = result;
+            }
+        }
+
+        //! Epistasis layer with a fixed block size Nu, applied in-place
+        static void epistasis(std::vector<int> &x)
+        {
+            const auto length = static_cast<int>(x.size());
+            auto i = 0;
+            for (; i + Nu <= length; i += Nu)
+                epistasis_block<Nu>(x.data() + i);
+            if (i < length)
+                utils::base_epistasis(x, i, length - i, x);
+        }
+
+    protected:
+        //! Evaluation method
+        double evaluate(const std::vector<int> &x) override
+        {
+            const std::vector<int> *wmodel_x = &x;
+
+            if constexpr (Dummy)
+            {
+                for (size_t i = 0; i < dummy_x_.size(); ++i)
+                    dummy_x_[i] = x[this->dummy_info_[i]];
+                wmodel_x = &dummy_x_;
+            }
+
+            if constexpr (Mu > 0)
+            {
+                neutrality(*wmodel_x, layer_x_);
+                wmodel_x = &layer_x_;
+            }
+
+            if constexpr (Nu > 0)
+            {
+                if (wmodel_x != &layer_x_)
+                    std::copy(wmodel_x->begin(), wmodel_x->end(), layer_x_.begin());
+                epistasis(layer_x_);
+                wmodel_x = &layer_x_;
+            }
+
+            // Non-virtual call, so the base function can be inlined
+            auto result = Base::wmodel_evaluate(*wmodel_x);
+
+            if constexpr (Gamma > 0)
+                result = this->ruggedness_info_[result];
+
+            return static_cast<double>(result);
+        }
+
+    public:
+        /**
+         * @brief Construct a new WModelT object
+         *
+         * @param instance instance id
+         * @param n_variables the dimension of the problem
+         * @param dummy_select_rate select rate, only used when the dummy layer is enabled
+         */
+        WModelT(const int instance, const int n_variables, const double dummy_select_rate = 0.5) :
+            Base(instance, n_variables, Dummy ? dummy_select_rate : 0.0, Nu, Mu, Gamma)
+        {
+            auto temp_dimension = static_cast<size_t>(n_variables);
+            if constexpr (Dummy)
+            {
+                if (dummy_select_rate <= 0)
+                    throw std::invalid_argument("The dummy select rate should be positive when the layer is enabled");
+                dummy_x_.resize(this->dummy_info_.size());
+                temp_dimension = dummy_x_.size();
+            }
+            if constexpr (Mu > 0)
+                temp_dimension /= Mu;
+            layer_x_.resize(temp_dimension);
+        }
+    };
+
+    //! Compile-time configured WModelOneMax
+    template <bool Dummy, int Mu, int Nu, int Gamma>
+    using WModelOneMaxT = WModelT<WModelOneMax, Dummy, Mu, Nu, Gamma>;
+
+    //! Compile-time configured WModelLeadingOnes
+    template <bool Dummy, int Mu, int Nu, int Gamma>
+    using WModelLeadingOnesT = WModelT<WModelLeadingOnes, Dummy, Mu, Nu, Gamma>;
+} // namespace ioh::problem::wmodel
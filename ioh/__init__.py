@@ -23,6 +23,12 @@ from .iohcpp import (
     IntegerState,
     MetaData,
     LogInfo,
+    StateTracking,
+    Termination,
+    RunTerminated,
+    CacheEviction,
+    CacheHits,
+    CacheStatistics,
 )
 
 
@@ -105,6 +111,7 @@ def wrap_problem(
     calculate_objective: typing.Callable[
         [int, int], typing.Union[IntegerSolution, RealSolution]
     ] = None,
+    vectorized: bool = False,
 ) -> ProblemType:
     """Function to wrap a callable as an ioh function
 
@@ -137,6 +144,11 @@ def wrap_problem(
         A function to calculate the global optimum of the function. This function gets a dimension and instance id,
         and should return either a Solution objective(IntegerSolution or RealSolution) or a tuple giving the
         x and y values for the global optimum. Where x is the search space representation and y the target value.
+    vectorized: bool
+        When True, function is called with a 2-dimensional numpy array holding a batch of points, one per row, and
+        should return a sequence with the objective value of each row. Evaluating a batch of points, i.e.
+        problem(X) for a 2-dimensional array X, then calls function only once. Single points are passed as a batch
+        of one.
     """
 
     if problem_type == "Integer":
@@ -157,6 +169,7 @@ def wrap_problem(
         transform_variables,
         transform_objectives,
         calculate_objective,
+        vectorized,
     )
     return get_problem(name, instance, dimension, problem_type)
 
@@ -212,6 +225,8 @@ class Experiment:
         merge_output: bool = True,
         zip_output: bool = True,
         remove_data: bool = False,
+        budget: int = None,
+        target_precision: float = None,
     ):
         """
         Parameters
@@ -279,6 +294,12 @@ class Experiment:
             remove_data: bool = False
                 Whether to remove all the produced data, except for the .zip file
                 (when produced).
+            budget: int = None
+                The maximum number of evaluations of a run. A run is aborted as soon as
+                the algorithm evaluates the problem after the budget is spent.
+            target_precision: float = None
+                The distance to the optimum at which a run is aborted, as soon as the
+                algorithm evaluates the problem after the target is reached.
         """
 
         self.algorithm = algorithm
@@ -306,6 +327,8 @@ class Experiment:
         self.merge_output = merge_output
         self.zip_output = zip_output
         self.remove_data = remove_data
+        self.budget = budget
+        self.target_precision = target_precision
 
         if os.path.isdir(self.logger_root) and self.merge_output:
             warnings.warn(
@@ -352,8 +375,18 @@ class Experiment:
     def apply(self, algorithm: any, problem: ProblemType):
         """Apply a given algorithm to a problem"""
 
+        if self.budget is not None:
+            problem.set_budget(self.budget)
+        if self.target_precision is not None:
+            problem.set_target(self.target_precision)
+        if self.budget is not None or self.target_precision is not None:
+            problem.set_termination(Termination.Abort)
+
         for _ in range(self.reps):
-            algorithm(problem)
+            try:
+                algorithm(problem)
+            except RunTerminated:
+                pass
             problem.reset()
 
     def add_custom_problem(self, p: ProblemType, name: str = None, **kwargs):
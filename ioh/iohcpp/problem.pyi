@@ -34,6 +34,11 @@ class Ellipsoid(BBOB):
 class EllipsoidRotated(BBOB):
     def __init__(self, instance: int, n_variables: int) -> None: ...
 
+class EvaluationFuture:
+    def __init__(self, *args, **kwargs) -> None: ...
+    def done(self) -> bool: ...
+    def result(self) -> float: ...
+
 class Gallagher101(BBOB):
     def __init__(self, instance: int, n_variables: int) -> None: ...
 
@@ -49,7 +54,13 @@ class Integer:
     def attach_logger(self, *args, **kwargs) -> Any: ...
     def create(self, *args, **kwargs) -> Any: ...
     def detach_logger(self, *args, **kwargs) -> Any: ...
+    def disable_memoization(self, *args, **kwargs) -> Any: ...
+    def enable_memoization(self, *args, **kwargs) -> Any: ...
     def reset(self, *args, **kwargs) -> Any: ...
+    def set_budget(self, *args, **kwargs) -> Any: ...
+    def set_state_tracking(self, *args, **kwargs) -> Any: ...
+    def set_target(self, *args, **kwargs) -> Any: ...
+    def set_termination(self, *args, **kwargs) -> Any: ...
     def __call__(self, *args, **kwargs) -> Any: ...
     @property
     def constraint(self) -> Any: ...
@@ -61,6 +72,20 @@ class Integer:
     def objective(self) -> Any: ...
     @property
     def state(self) -> Any: ...
+    @property
+    def terminated(self) -> bool: ...
+
+class IntegerAsyncEvaluator:
+    def __init__(self, problem: Integer, n_workers: int = ...) -> None: ...
+    def close(self) -> None: ...
+    def submit(self, x: List[int]) -> EvaluationFuture: ...
+    def wait(self) -> None: ...
+    @property
+    def in_flight(self) -> int: ...
+    @property
+    def n_workers(self) -> int: ...
+    @property
+    def problem(self) -> Integer: ...
 
 class IntegerWrappedProblem(Integer):
     def __init__(self, *args, **kwargs) -> None: ...
@@ -159,7 +184,13 @@ class Real:
     def attach_logger(self, *args, **kwargs) -> Any: ...
     def create(self, *args, **kwargs) -> Any: ...
     def detach_logger(self, *args, **kwargs) -> Any: ...
+    def disable_memoization(self, *args, **kwargs) -> Any: ...
+    def enable_memoization(self, *args, **kwargs) -> Any: ...
     def reset(self, *args, **kwargs) -> Any: ...
+    def set_budget(self, *args, **kwargs) -> Any: ...
+    def set_state_tracking(self, *args, **kwargs) -> Any: ...
+    def set_target(self, *args, **kwargs) -> Any: ...
+    def set_termination(self, *args, **kwargs) -> Any: ...
     def __call__(self, *args, **kwargs) -> Any: ...
     @property
     def constraint(self) -> Any: ...
@@ -171,6 +202,20 @@ class Real:
     def objective(self) -> Any: ...
     @property
     def state(self) -> Any: ...
+    @property
+    def terminated(self) -> bool: ...
+
+class RealAsyncEvaluator:
+    def __init__(self, problem: Real, n_workers: int = ...) -> None: ...
+    def close(self) -> None: ...
+    def submit(self, x: List[float]) -> EvaluationFuture: ...
+    def wait(self) -> None: ...
+    @property
+    def in_flight(self) -> int: ...
+    @property
+    def n_workers(self) -> int: ...
+    @property
+    def problem(self) -> Real: ...
 
 class RealWrappedProblem(Real):
     def __init__(self, *args, **kwargs) -> None: ...
@@ -208,5 +253,5 @@ class WModelOneMax(AbstractWModel):
 class Weierstrass(BBOB):
     def __init__(self, instance: int, n_variables: int) -> None: ...
 
-def wrap_integer_problem(f: handle, name: str, optimization_type: ioh.iohcpp.OptimizationType = ..., lb: Optional[float] = ..., ub: Optional[float] = ..., transform_variables: Optional[handle] = ..., transform_objectives: Optional[handle] = ..., calculate_objective: Optional[handle] = ...) -> None: ...
-def wrap_real_problem(f: handle, name: str, optimization_type: ioh.iohcpp.OptimizationType = ..., lb: Optional[float] = ..., ub: Optional[float] = ..., transform_variables: Optional[handle] = ..., transform_objectives: Optional[handle] = ..., calculate_objective: Optional[handle] = ...) -> None: ...
+def wrap_integer_problem(f: handle, name: str, optimization_type: ioh.iohcpp.OptimizationType = ..., lb: Optional[float] = ..., ub: Optional[float] = ..., transform_variables: Optional[handle] = ..., transform_objectives: Optional[handle] = ..., calculate_objective: Optional[handle] = ..., vectorized: bool = ...) -> None: ...
+def wrap_real_problem(f: handle, name: str, optimization_type: ioh.iohcpp.OptimizationType = ..., lb: Optional[float] = ..., ub: Optional[float] = ..., transform_variables: Optional[handle] = ..., transform_objectives: Optional[handle] = ..., calculate_objective: Optional[handle] = ..., vectorized: bool = ...) -> None: ...
@@ -24,6 +24,7 @@ public:
 
     std::optional<double> operator()(const logger::Info &) const override
     {
+        py::gil_scoped_acquire gil; // Problems may be evaluated without holding the GIL
         if (py::hasattr(container_, attribute_.c_str())){
             auto pyobj = container_.attr(attribute_.c_str()).ptr();
             if (pyobj != Py_None)
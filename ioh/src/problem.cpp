@@ -1,4 +1,5 @@
 #include <pybind11/functional.h>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include "ioh.hpp"
@@ -162,6 +163,63 @@ public:
     }
 };
 
+//! A batch of search points, in a C-contiguous array of the type of the variables
+template <typename T>
+using BatchArray = py::array_t<T, py::array::c_style | py::array::forcecast>;
+
+/**
+ * The argument of a batch evaluation. Integer problems take any array-like object, whose type is checked by
+ * as_batch_array, since forcing the cast of floats to int32 would silently truncate them.
+ */
+template <typename T>
+using BatchArgument = std::conditional_t<std::is_integral_v<T>, py::object, BatchArray<T>>;
+
+//! Convert the argument of a batch evaluation, rejecting non-integral values for integer problems
+template <typename T>
+BatchArray<T> as_batch_array(const BatchArgument<T> &x)
+{
+    if constexpr (std::is_integral_v<T>)
+    {
+        const auto array = py::array::ensure(x);
+        if (!array)
+            throw py::type_error("Expected an array of search points");
+        const auto kind = array.dtype().kind();
+        if (kind != 'i' && kind != 'u' && kind != 'b')
+            throw py::type_error(fmt::format("Expected an array of integers, got dtype {}",
+                                             py::str(array.dtype()).cast<std::string>()));
+        return BatchArray<T>::ensure(array);
+    }
+    else
+        return x;
+}
+
+//! Evaluate the rows of a 2-dimensional array as a batch, without holding the GIL
+template <typename ProblemType, typename T>
+py::array_t<double> evaluate_array(ProblemType &problem, const BatchArgument<T> &x)
+{
+    const auto xs = as_batch_array<T>(x);
+    if (xs.ndim() != 2)
+        throw py::value_error(fmt::format("Expected a 2-dimensional array of search points, got {} dimension(s)",
+                                          xs.ndim()));
+
+    const auto n_points = static_cast<size_t>(xs.shape(0));
+    const auto n_variables = static_cast<size_t>(xs.shape(1));
+    py::array_t<double> ys(static_cast<py::ssize_t>(n_points));
+    const auto *x_data = xs.data();
+    auto *y_data = ys.mutable_data();
+    {
+        // Problems and loggers implemented in Python acquire the GIL when they are called
+        py::gil_scoped_release release;
+        // The problems evaluate std::vector points, so each row is copied once
+        std::vector<std::vector<T>> points(n_points);
+        for (size_t i = 0; i < n_points; ++i)
+            points[i].assign(x_data + i * n_variables, x_data + (i + 1) * n_variables);
+        const auto values = problem(points);
+        std::copy(values.begin(), values.end(), y_data);
+    }
+    return ys;
+}
+
 template <typename ProblemType, typename T>
 void define_base_class(py::module &m, const std::string &name)
 {
@@ -198,7 +256,76 @@ void define_base_class(py::module &m, const std::string &name)
              R"pbdoc(
                 Remove the specified logger from the problem.
             )pbdoc")
-        .def("__call__", &ProblemType::operator(),
+        .def("set_state_tracking", &ProblemType::set_state_tracking, py::arg("tracking"),
+             R"pbdoc(
+                Set how much of the evaluated solutions the state keeps track of.
+
+                Below StateTracking.Full, the variables of the current and best solutions are not stored in the
+                state. The level is raised to what the problem and the attached logger need.
+
+                Parameters
+                ----------
+                    tracking: StateTracking
+                        The requested tracking level
+            )pbdoc")
+        .def_property_readonly("state_tracking", &ProblemType::state_tracking,
+                               "The tracking level that is used by the state")
+        .def("enable_memoization", &ProblemType::enable_memoization, py::arg("capacity"),
+             py::arg("eviction") = ioh::problem::CacheEviction::LRU, py::arg("hits") = ioh::problem::CacheHits::Counted,
+             R"pbdoc(
+                Memoize the evaluations of the problem in a bounded cache.
+
+                Points that were evaluated before are answered from the cache. The problem must be deterministic.
+
+                Parameters
+                ----------
+                    capacity: int
+                        The maximum number of cached points
+                    eviction: CacheEviction
+                        How points are evicted when the cache is full
+                    hits: CacheHits
+                        Whether hits are counted as evaluations and logged, or are free
+            )pbdoc")
+        .def("disable_memoization", &ProblemType::disable_memoization,
+             R"pbdoc(
+                Stop memoizing the evaluations, and drop the cache.
+            )pbdoc")
+        .def_property_readonly("memoization_statistics", &ProblemType::memoization_statistics,
+                               "The counters of the evaluation cache, such as its hit rate")
+        .def("set_budget", &ProblemType::set_budget, py::arg("budget"),
+             R"pbdoc(
+                Set the maximum number of evaluations of a run.
+
+                Once the budget is spent, further evaluations are handled according to the termination policy.
+
+                Parameters
+                ----------
+                    budget: int
+                        The maximum number of evaluations
+            )pbdoc")
+        .def("set_target", &ProblemType::set_target, py::arg("precision"),
+             R"pbdoc(
+                Set the target of a run, at the given distance to the optimum.
+
+                Once the target is reached, further evaluations are handled according to the termination policy.
+
+                Parameters
+                ----------
+                    precision: float
+                        The distance to the objective value of the optimum
+            )pbdoc")
+        .def("set_termination", &ProblemType::set_termination, py::arg("termination"),
+             R"pbdoc(
+                Set how evaluations are handled once the budget is spent or the target is reached.
+
+                Parameters
+                ----------
+                    termination: Termination
+                        The termination policy
+            )pbdoc")
+        .def_property_readonly("terminated", &ProblemType::terminated,
+                               "Whether the budget is spent or the target is reached")
+        .def("__call__", py::overload_cast<const std::vector<T> &>(&ProblemType::operator()),
              R"pbdoc(
                 Evaluate the problem.
 
@@ -207,6 +334,25 @@ void define_base_class(py::module &m, const std::string &name)
                     x: list
                         the search point to evaluate. It must be a 1-dimensional array/list whose length matches search space's dimensionality
             )pbdoc")
+        .def("__call__", &evaluate_array<ProblemType, T>, py::arg("x"),
+             R"pbdoc(
+                Evaluate a batch of search points.
+
+                The points are evaluated in C++ as a single batch, with the GIL released, and every evaluation
+                updates the state and is logged as if the points were evaluated one by one, in the order of the rows.
+                A C-contiguous array of the problem's type (float64 for Real, int32 for Integer) is used as is, other
+                arrays are converted first. The rows are then copied into the vectors that the C++ problem evaluates.
+                Integer problems raise a TypeError for arrays of floats, rather than truncating them.
+
+                Parameters
+                ----------
+                    x: numpy.ndarray
+                        the search points to evaluate, a 2-dimensional array with one point per row
+                
+                Returns
+                -------
+                    numpy.ndarray: the objective values of the points
+            )pbdoc")
         .def_static(
             "create",
             [](const std::string &name, int iid, int dim) { return Factory::instance().create(name, iid, dim); },
@@ -278,13 +424,18 @@ void define_wrapper_functions(py::module &m, const std::string &class_name, cons
         function_name.c_str(),
         [](py::handle f, const std::string &name, ioh::common::OptimizationType t, std::optional<double> lb,
            std::optional<double> ub, std::optional<py::handle> tx, std::optional<py::handle> ty,
-           std::optional<py::handle> co) {
+           std::optional<py::handle> co, const bool vectorized) {
             register_python_fn(f);
-            auto of = [f](const std::vector<T> &x) { return PyFloat_AsDouble(f(x).ptr()); };
+            // The callbacks acquire the GIL, as batch evaluations release it
+            auto of = [f](const std::vector<T> &x) {
+                py::gil_scoped_acquire gil;
+                return PyFloat_AsDouble(f(x).ptr());
+            };
 
             auto ptx = [tx](std::vector<T> x, const int iid) {
                 if (tx)
                 {
+                    py::gil_scoped_acquire gil;
                     static bool r = register_python_fn(tx.value());
                     py::list px = (tx.value()(x, iid));
                     if (px.size() == x.size())
@@ -301,6 +452,7 @@ void define_wrapper_functions(py::module &m, const std::string &class_name, cons
             auto pty = [ty](double y, const int iid) {
                 if (ty)
                 {
+                    py::gil_scoped_acquire gil;
                     static bool r = register_python_fn(ty.value());
                     return PyFloat_AsDouble(ty.value()(y, iid).ptr());
                 }
@@ -324,11 +476,30 @@ void define_wrapper_functions(py::module &m, const std::string &class_name, cons
                 return Solution<T>(dim, t);
             };
 
-            wrap_function<T>(of, name, t, lb, ub, ptx, pty, pco);
+            if (!vectorized)
+                return wrap_function<T>(of, name, t, lb, ub, ptx, pty, pco);
+
+            // The vectorized function receives the whole batch as a 2-dimensional array, one point per row
+            auto bf = [f](const std::vector<std::vector<T>> &xs) {
+                py::gil_scoped_acquire gil;
+                const auto n_variables = xs.empty() ? size_t{0} : xs[0].size();
+                py::array_t<T> points({static_cast<py::ssize_t>(xs.size()), static_cast<py::ssize_t>(n_variables)});
+                auto *data = points.mutable_data();
+                for (const auto &x : xs)
+                    data = std::copy(x.begin(), x.end(), data);
+
+                auto ys = f(points).template cast<std::vector<double>>();
+                if (ys.size() != xs.size())
+                    throw std::runtime_error(fmt::format("Vectorized objective function returned {} values for {} "
+                                                         "points", ys.size(), xs.size()));
+                return ys;
+            };
+            wrap_batch_function<T>(bf, name, t, lb, ub, ptx, pty, pco);
         },
         py::arg("f"), py::arg("name"), py::arg("optimization_type") = ioh::common::OptimizationType::Minimization,
         py::arg("lb") = std::nullopt, py::arg("ub") = std::nullopt, py::arg("transform_variables") = std::nullopt,
-        py::arg("transform_objectives") = std::nullopt, py::arg("calculate_objective") = std::nullopt);
+        py::arg("transform_objectives") = std::nullopt, py::arg("calculate_objective") = std::nullopt,
+        py::arg("vectorized") = false);
 }
 
 #if defined(__GNUC__)
@@ -343,6 +514,42 @@ void define_helper_classes(py::module &m)
         .value("Minimization", ioh::common::OptimizationType::Minimization)
         .export_values();
 
+    py::enum_<ioh::problem::StateTracking>(
+        m, "StateTracking", "Enum used for defining how much of the evaluated solutions the state of a problem tracks")
+        .value("Evaluations", ioh::problem::StateTracking::Evaluations,
+               "Only the number of evaluations and the current objective value")
+        .value("Objectives", ioh::problem::StateTracking::Objectives,
+               "The current and best objective values, but not the variables")
+        .value("Full", ioh::problem::StateTracking::Full, "The current and best solutions, variables included");
+
+    py::enum_<ioh::problem::Termination>(
+        m, "Termination", "Enum used for defining how a problem handles evaluations once its run is terminated")
+        .value("Flag", ioh::problem::Termination::Flag, "Evaluations proceed, the problem is only flagged as terminated")
+        .value("Refuse", ioh::problem::Termination::Refuse, "Evaluations are refused, and return NaN")
+        .value("Abort", ioh::problem::Termination::Abort, "Evaluations raise RunTerminated");
+
+    py::register_exception<ioh::problem::RunTerminated>(m, "RunTerminated", PyExc_RuntimeError);
+
+    py::enum_<ioh::problem::CacheEviction>(m, "CacheEviction",
+                                           "Enum used for defining how points are evicted from a full evaluation cache")
+        .value("LRU", ioh::problem::CacheEviction::LRU, "The least recently used point is evicted")
+        .value("Clock", ioh::problem::CacheEviction::Clock, "The CLOCK approximation of LRU");
+
+    py::enum_<ioh::problem::CacheHits>(m, "CacheHits",
+                                       "Enum used for defining how evaluations answered by the cache are accounted for")
+        .value("Counted", ioh::problem::CacheHits::Counted, "Hits are counted as evaluations, and logged")
+        .value("Free", ioh::problem::CacheHits::Free, "Hits are not counted, do not update the state nor are logged");
+
+    py::class_<ioh::problem::CacheStatistics>(m, "CacheStatistics")
+        .def_readonly("hits", &ioh::problem::CacheStatistics::hits, "Number of lookups that found the point")
+        .def_readonly("misses", &ioh::problem::CacheStatistics::misses, "Number of lookups that did not find the point")
+        .def_readonly("evictions", &ioh::problem::CacheStatistics::evictions, "Number of evicted points")
+        .def_readonly("size", &ioh::problem::CacheStatistics::size, "Number of points in the cache")
+        .def_readonly("capacity", &ioh::problem::CacheStatistics::capacity, "Maximum number of points in the cache")
+        .def_property_readonly("hit_rate", &ioh::problem::CacheStatistics::hit_rate,
+                               "The fraction of the lookups that were hits")
+        .def("__repr__", &ioh::problem::CacheStatistics::repr);
+
     define_solution<double>(m, "RealSolution");
     define_solution<int>(m, "IntegerSolution");
     define_constraint<int>(m, "IntegerConstraint");
@@ -381,7 +588,12 @@ void define_helper_classes(py::module &m)
         .def("__repr__", &MetaData::repr);
 
     py::class_<ioh::logger::Info>(m, "LogInfo")
-        .def(py::init<size_t, double, double, double, Solution<double>, Solution<double>>(), py::arg("evaluations"),
+        .def(py::init([](const size_t evaluations, const double raw_y_best, const double transformed_y,
+                         const double transformed_y_best, Solution<double> current, Solution<double> optimum) {
+                 return ioh::logger::Info{evaluations, raw_y_best, transformed_y, transformed_y_best,
+                                          ioh::logger::SolutionView::owning(std::move(current)), std::move(optimum)};
+             }),
+             py::arg("evaluations"),
              py::arg("raw_y_best"), py::arg("transformed_y"), py::arg("transformed_y_best"), py::arg("current"),
              py::arg("optimum"),
              R"pbdoc(
@@ -410,7 +622,9 @@ void define_helper_classes(py::module &m)
                       "The internal representation of the current fitness value")
         .def_readonly("transformed_y_best", &ioh::logger::Info::transformed_y_best,
                       "The internal representation of the best-so-far fitness")
-        .def_readonly("current", &ioh::logger::Info::current, "The fitness of the last evaluated solution")
+        .def_property_readonly(
+            "current", [](const ioh::logger::Info &info) { return info.current.as_double(); },
+            "The last evaluated solution, with its variables converted to float")
         .def_readonly("objective", &ioh::logger::Info::optimum, "The best possible fitness value");
 }
 
@@ -677,12 +891,78 @@ void define_bbob_problems(py::module &m)
         .def(py::init<int, int>(), py::arg("instance"), py::arg("n_variables"));
 }
 
+template <typename T>
+void define_async_evaluator(py::module &m, const std::string &name)
+{
+    using Evaluator = AsyncEvaluator<T>;
+
+    // The workers may need the GIL to evaluate the problem, so every call that waits for them releases it
+    py::class_<Evaluator, std::shared_ptr<Evaluator>>(m, name.c_str())
+        .def(py::init([](std::shared_ptr<Problem<T>> problem, const size_t n_workers) {
+                 return std::shared_ptr<Evaluator>(new Evaluator(std::move(problem), n_workers), [](Evaluator *e) {
+                     py::gil_scoped_release release;
+                     delete e;
+                 });
+             }),
+             py::arg("problem"), py::arg("n_workers") = std::max(std::thread::hardware_concurrency(), 1u),
+             R"pbdoc(
+                Evaluates a problem asynchronously, on a bounded pool of worker threads.
+
+                The updates of the state of the problem and the calls to its logger are applied in submission order.
+                Only wrapped problems are evaluated by several workers at once, the others use a single worker.
+
+                Parameters
+                ----------
+                    problem: Problem
+                        The problem to evaluate
+                    n_workers: int
+                        The maximum number of solutions evaluated at once
+            )pbdoc")
+        .def(
+            "submit", [](Evaluator &evaluator, std::vector<T> x) { return evaluator.submit(std::move(x)).share(); },
+            py::arg("x"), py::call_guard<py::gil_scoped_release>(),
+            R"pbdoc(
+                Submit a solution for evaluation.
+
+                Parameters
+                ----------
+                    x: list
+                        The solution
+
+                Returns
+                -------
+                    An EvaluationFuture of the objective value, ready once x is committed to the state
+            )pbdoc")
+        .def("wait", &Evaluator::wait, py::call_guard<py::gil_scoped_release>(),
+             "Wait until all submitted solutions are committed")
+        .def("close", &Evaluator::close, py::call_guard<py::gil_scoped_release>(),
+             "Finish the evaluations in flight, then stop the workers")
+        .def_property_readonly("in_flight", &Evaluator::in_flight,
+                               "The number of submitted solutions which are not committed yet")
+        .def_property_readonly("n_workers", &Evaluator::n_workers, "The number of worker threads")
+        .def_property_readonly("problem", &Evaluator::problem, "The evaluated problem");
+}
+
 void define_problem_bases(py::module &m)
 {
     define_base_class<Real, double>(m, "Real");
     define_base_class<Integer, int>(m, "Integer");
     define_wrapper_functions<double>(m, "RealWrappedProblem", "wrap_real_problem");
     define_wrapper_functions<int>(m, "IntegerWrappedProblem", "wrap_integer_problem");
+
+    py::class_<std::shared_future<double>>(m, "EvaluationFuture", "The objective value of a submitted solution")
+        .def(
+            "result", [](const std::shared_future<double> &future) { return future.get(); },
+            py::call_guard<py::gil_scoped_release>(),
+            "Wait for the objective value, or raise the error of the evaluation, e.g. RunTerminated")
+        .def(
+            "done",
+            [](const std::shared_future<double> &future) {
+                return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+            },
+            "Is the objective value ready?");
+    define_async_evaluator<double>(m, "RealAsyncEvaluator");
+    define_async_evaluator<int>(m, "IntegerAsyncEvaluator");
 }
 
 class WModelTrampoline : public WModel
@@ -4,35 +4,21 @@
 #include <fstream>
 #include <algorithm>
 #include <filesystem>
-
-#if __cplusplus == 202002L
-#include <chrono>
-#else
-#include <ctime>
-#endif
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <csignal>
 
 #include <cxxopts.hpp>
 #include <clutchlog/clutchlog.h>
-#include <nlohmann/json.hpp>
-using json = nlohmann::json;
 
 #include <ioh.hpp>
 
-//! Error codes returned on exit.
-enum class Error : unsigned char {
-    No_Error = 0,
-    No_File = 2, // ENOENT
-    Invalid_Argument = 22, // EINVAL
-    Not_FIFO = 60, // ENOSTR
-    Unreadable = 77, // EBADFD
-    Missing_Argument = 132,
-    Payload_Parse,
-    Payload_Type,
-    Payload_Incomplete,
-    Dimension_Mismatch,
-    Not_Supported,
-    Unknown = 255
-};
+#include "protocol.hpp"
+#include "transport.hpp"
 
 //! Macro to hide the necessary verbose casting.
 #ifdef WITH_CLUTCHLOG
@@ -53,15 +39,6 @@ enum class Error : unsigned char {
 
 #define EXIT(IOH_server_err_code) exit(static_cast<unsigned char>(Error::IOH_server_err_code))
 
-//! Strip spaces around the input string.
-std::string strip(std::string s)
-{
-    s.erase(std::find_if( s.rbegin(), s.rend(),
-            [](int ch) { return !std::isspace(ch); }
-        ).base(), s.end());
-    return s;
-}
-
 //! Split a string in a vector.
 template<class T>
 std::vector<T> split(const std::string& str, char delim = ',') {
@@ -77,132 +54,494 @@ std::vector<T> split(const std::string& str, char delim = ',') {
     return vec;
 }
 
-//! Write a message in a file.
-void send(const std::string& filename, const std::string& msg)
+template<class T>
+void list_problems()
 {
-    CLUTCHLOG(debug, "Send response...");
-    std::ofstream ofs( filename );
-    if(ofs.fail()) {
-        EXIT_ON_ERROR(Unreadable, "Output fifo named pipe cannot be read.");
+    std::cout << "Available problems:" << std::endl;
+    for(const auto& name : ioh::problem::ProblemRegistry<T>::instance().names()) {
+        std::cout << "\t" << name << std::endl;
     }
-    ofs << msg << std::endl;
-    ofs.close();
-    CLUTCHLOG(xdebug, "Sent: `" << msg << "`.");
 }
 
-//! Read a message in a file.
-std::string read(const std::string& filename)
+//! The name of a registered problem, given by its name or by its identifier, or nothing if there is none.
+template<class T>
+std::optional<std::string> find_problem(const std::string& name, const std::optional<int> id = std::nullopt)
 {
-    CLUTCHLOG(debug, "Wait for query... ");
-    std::ifstream ifs( filename );
-    if(ifs.fail()) {
-        EXIT_ON_ERROR(Unreadable, "Input fifo named pipe cannot be written.");
+    const auto& factory = ioh::problem::ProblemRegistry<T>::instance();
+    if(id) {
+        const auto ids = factory.map();
+        const auto it = ids.find(*id);
+        if(it != ids.end()) {
+            return it->second;
+        }
+    } else {
+        const auto names = factory.names();
+        if(std::find(names.begin(), names.end(), name) != names.end()) {
+            return name;
+        }
     }
-    std::stringstream datas;
-    datas << ifs.rdbuf();
-    ifs.close();
-    std::string data = strip(datas.str());
-    CLUTCHLOG(xdebug, "Received: `" << data << "`");
-    return data;
+    return std::nullopt;
 }
 
-std::string timestamp()
-{
-#if __cplusplus == 202002L
-    const auto now = std::chrono::system_clock::now();
-    return std::format("{:%FT%TZ}", now);
-#else
-    time_t now;
-    time(&now);
-    char buf[sizeof "2021-12-21T22:32:09Z"];
-    strftime(buf, sizeof buf, "%FT%TZ", gmtime(&now));
-    // If a  compiler doesn't support %F or %T, we can fallback to:
-    //strftime(buf, sizeof buf, "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
-    return buf;
-#endif
-}
+/** The problems already constructed by a session, by name, instance and dimension.
+ *
+ * Switching back to a cached problem costs no construction, which may be more costly than the whole run for
+ * short budgets. Beyond the capacity of the cache, the least recently used problems are dropped.
+ */
+template<class T>
+class ProblemCache {
+public:
+    using Key = std::tuple<std::string, int, int>;
+
+protected:
+    size_t capacity_;
+
+    //! Most recently used first.
+    std::list<std::pair<Key, std::shared_ptr<T>>> entries_;
+
+public:
+    explicit ProblemCache(const size_t capacity) : capacity_(std::max<size_t>(capacity, 1)) {}
+
+    //! Get a problem, which is constructed if it is not in the cache.
+    std::shared_ptr<T> get(const Key& key)
+    {
+        const auto it = std::find_if(entries_.begin(), entries_.end(),
+            [&key](const auto& entry) { return entry.first == key; });
+        if(it != entries_.end()) {
+            CLUTCHLOG(debug, "Problem found in the cache.");
+            entries_.splice(entries_.begin(), entries_, it);
+        } else {
+            CLUTCHLOG(debug, "Construct the problem.");
+            const auto& [name, instance, dimension] = key;
+            entries_.emplace_front(key, ioh::problem::ProblemRegistry<T>::instance().create(name, instance, dimension));
+            if(entries_.size() > capacity_) {
+                entries_.pop_back();
+            }
+        }
+        return entries_.front().second;
+    }
 
-json forge_default()
-{
-    json j = {
-        {"remarks", "ioh-server v0.1.0"},
-        {"timestamp", timestamp()}
-    };
-    return j;
-}
+    size_t size() const { return entries_.size(); }
+};
 
-json forge_ack()
+template<class T>
+Reply call(std::shared_ptr<T> problem, const Query& query)
 {
-    json jreply = forge_default();
-    jreply["reply_type"] = "ack";
-    return jreply;
-}
+    /***** Sanity checks. *****/
+    const int dimension = problem->meta_data().n_variables;
+    if(static_cast<int>(query.solution.size()) != dimension) {
+        std::ostringstream msg;
+        msg << "Received a solution of size " << query.solution.size() << ", which does not match the problem's dimension of " << dimension;
+        CLUTCHLOG(error, msg.str());
+        return forge_error(msg.str(), Error::Dimension_Mismatch);
+    }
+    // TODO check domain constraints.
 
-json forge_error(const std::string msg, const Error code = Error::Unknown)
-{
-    json jreply = forge_default();
-    jreply["reply_type"] = "error";
-    jreply["message"] = msg;
-    jreply["code"] = code;
-    return jreply;
+    const std::vector<typename T::Type> sol(query.solution.begin(), query.solution.end());
+
+    CLUTCHLOG(debug, "Call the objective function...");
+    double fval = (*problem)(sol);
+    CLUTCHLOG(xdebug, "Result: `" << fval << "`.");
+
+    return forge_value(fval, query.solution);
 }
 
+/** Evaluate a batch of solutions at once.
+ *
+ * The solutions are evaluated in order, so the logger sees the same sequence of evaluations as with as many `call`
+ * queries.
+ */
 template<class T>
-json forge_value(const double val, const std::vector<T> sol)
+Reply batch(std::shared_ptr<T> problem, const Query& query)
 {
-    json jreply = forge_default();
-    jreply["reply_type"] = "value";
-    jreply["value"] = val;
-    jreply["solution"] = sol;
-    return jreply;
+    const int dimension = problem->meta_data().n_variables;
+    std::vector<std::vector<typename T::Type>> sols;
+    sols.reserve(query.solutions.size());
+    for(const auto& solution : query.solutions) {
+        if(static_cast<int>(solution.size()) != dimension) {
+            std::ostringstream msg;
+            msg << "Received a solution of size " << solution.size() << " at index " << sols.size() << " of the batch, which does not match the problem's dimension of " << dimension;
+            CLUTCHLOG(error, msg.str());
+            return forge_error(msg.str(), Error::Dimension_Mismatch);
+        }
+        sols.emplace_back(solution.begin(), solution.end());
+    }
 
+    CLUTCHLOG(debug, "Call the objective function on a batch of " << sols.size() << " solutions...");
+    return forge_values((*problem)(sols));
 }
 
-//! Send back an error message to the client and log it.
-void error(const std::string& filename, const std::string& msg, const Error code = Error::Unknown)
-{
-    CLUTCHLOG(error, msg);
-    json jquery = forge_error(msg, code);
-    send(filename, jquery.dump());
-}
+/** The problem and the logger of a client.
+ *
+ * Every client of the socket transport has its own session, hence its own problem instance and its own data folder.
+ *
+ * The client may switch to another problem at any time, without restarting the server. The logger is then detached
+ * from the current problem, which ends its run, and attached to the next one. Problems are kept in a cache, so
+ * switching back to a problem does not construct it again. The problem is reset whenever it is switched to, so that
+ * it always starts a new run.
+ */
+class Session {
+protected:
+    std::string type_;
 
-template<class T>
-std::shared_ptr<T> create( const cxxopts::ParseResult& asked)
+    // FIXME check if IOH can have the necessary abstract interfaces here.
+    std::shared_ptr<ioh::problem::Integer> problem_int_ = nullptr;
+    std::shared_ptr<ioh::problem::Real>    problem_real_ = nullptr;
+
+    ProblemCache<ioh::problem::Integer> cache_int_;
+    ProblemCache<ioh::problem::Real>    cache_real_;
+
+    ioh::logger::Analyzer logger_;
+
+    //! Is the logger attached to the current problem?
+    bool logging_ = true;
+
+    //! Switch to another problem.
+    template<class T>
+    Reply select(std::shared_ptr<T>& problem, ProblemCache<T>& cache, const Query& query)
+    {
+        const auto name = find_problem<T>(query.problem, query.problem_id);
+        if(not name) {
+            std::ostringstream msg;
+            msg << "Unknown problem: `";
+            if(query.problem_id) {
+                msg << *query.problem_id;
+            } else {
+                msg << query.problem;
+            }
+            msg << "`.";
+            CLUTCHLOG(error, msg.str());
+            return forge_error(msg.str(), Error::Unknown_Problem);
+        }
+        const int instance = query.instance.value_or(problem->meta_data().instance);
+        const int dimension = query.dimension.value_or(problem->meta_data().n_variables);
+        if(dimension < 1) {
+            CLUTCHLOG(error, "Problem dimension cannot be < 1.");
+            return forge_error("Problem dimension cannot be < 1.", Error::Invalid_Argument);
+        }
+
+        CLUTCHLOG(note, "Switch to problem " << *name << ", instance " << instance << ", dimension " << dimension << ".");
+        // Construct the next problem first, so that the session goes on with the current one if it fails.
+        std::shared_ptr<T> next;
+        try {
+            next = cache.get({*name, instance, dimension});
+        } catch (std::exception& ex) {
+            CLUTCHLOG(error, ex.what());
+            return forge_error(ex.what(), Error::Invalid_Argument);
+        }
+        if(next->meta_data().n_variables < 1) {
+            // e.g. a graph problem whose instance files cannot be found.
+            CLUTCHLOG(error, "The problem has no variables.");
+            return forge_error("The problem has no variables.", Error::Invalid_Argument);
+        }
+        if(logging_) {
+            problem->detach_logger();
+        }
+        problem = std::move(next);
+        // A problem taken back from the cache starts a new run, as the logger does.
+        problem->reset();
+        if(logging_) {
+            problem->attach_logger(logger_);
+        }
+        return forge_ack();
+    }
+
+    //! Attach or detach the logger.
+    template<class T>
+    Reply log(std::shared_ptr<T>& problem, const bool attach)
+    {
+        if(attach and not logging_) {
+            CLUTCHLOG(note, "Attach the logger.");
+            problem->attach_logger(logger_);
+        } else if(not attach and logging_) {
+            CLUTCHLOG(note, "Detach the logger.");
+            problem->detach_logger();
+        }
+        logging_ = attach;
+        return forge_ack();
+    }
+
+public:
+    explicit Session(const cxxopts::ParseResult& asked) :
+        type_(asked["type"].as<std::string>()),
+        cache_int_(asked["cache-size"].as<size_t>()),
+        cache_real_(asked["cache-size"].as<size_t>()),
+        logger_(
+            {ioh::trigger::on_improvement},
+            {}, // additional properties // TODO FIXME find a way to handle (undeclared?) properties from the client.
+            fs::current_path(), // Not sure it would be useful to let this be a parameter, as we already have folder and the service is single-expe by design.
+            asked["folder"].as<std::string>(),
+            asked["solver"].as<std::string>(),
+            asked["metadata"].as<std::string>(),
+            false, // store positions
+            {}, // attributes
+            true // switching back to a problem goes on writing its files
+        )
+    {
+        const ProblemCache<ioh::problem::Integer>::Key key{
+            asked["problem"].as<std::string>(), asked["instance"].as<int>(), asked["dimension"].as<int>()};
+        if(type_ == "integer") {
+            problem_int_ = cache_int_.get(key);
+            problem_int_->attach_logger(logger_);
+        } else if(type_ == "real") {
+            problem_real_ = cache_real_.get(key);
+            problem_real_->attach_logger(logger_);
+        }
+        // TODO parametrize W-model?
+    }
+
+    Session(const Session&) = delete;
+    Session& operator=(const Session&) = delete;
+
+    //! Are the variables integers?
+    bool integer() const { return type_ == "integer"; }
+
+    //! Answer a query, sets `stop` if the server has been asked to exit.
+    Reply answer(const Query& query, bool& stop)
+    {
+        switch(query.type) {
+            /******************************************************************
+             * stop
+             *****************************************************************/
+            case QueryType::Stop:
+                CLUTCHLOG(progress, "Been asked to exit.");
+                stop = true;
+                return forge_ack();
+
+            /******************************************************************
+             * new_run
+             *****************************************************************/
+            case QueryType::NewRun:
+                CLUTCHLOG(note, "Reset the logger for a new run.");
+                logger_.reset();
+                return forge_ack();
+
+            /******************************************************************
+             * call
+             *****************************************************************/
+            case QueryType::Call:
+                if(integer()) {
+                    return call<ioh::problem::Integer>(problem_int_, query);
+                } else {
+                    return call<ioh::problem::Real>(problem_real_, query);
+                }
+
+            /******************************************************************
+             * batch
+             *****************************************************************/
+            case QueryType::Batch:
+                if(integer()) {
+                    return batch<ioh::problem::Integer>(problem_int_, query);
+                } else {
+                    return batch<ioh::problem::Real>(problem_real_, query);
+                }
+
+            /******************************************************************
+             * problem
+             *****************************************************************/
+            case QueryType::Problem:
+                if(integer()) {
+                    return select(problem_int_, cache_int_, query);
+                } else {
+                    return select(problem_real_, cache_real_, query);
+                }
+
+            /******************************************************************
+             * reset
+             *****************************************************************/
+            case QueryType::Reset:
+                CLUTCHLOG(note, "Reset the problem for a new run.");
+                if(integer()) {
+                    problem_int_->reset();
+                } else {
+                    problem_real_->reset();
+                }
+                return forge_ack();
+
+            /******************************************************************
+             * attach_logger / detach_logger
+             *****************************************************************/
+            case QueryType::AttachLogger:
+            case QueryType::DetachLogger:
+                if(integer()) {
+                    return log(problem_int_, query.type == QueryType::AttachLogger);
+                } else {
+                    return log(problem_real_, query.type == QueryType::AttachLogger);
+                }
+
+            case QueryType::Hello:
+                return forge_error("Query `hello` is only supported by the stream and socket protocols.", Error::Not_Supported);
+        }
+        return forge_error("Unknown query.", Error::Not_Supported);
+    }
+};
+
+/** Serve the queries of a session.
+ *
+ * In a stream session, a `hello` query negotiates the encoding of the next messages: the client lists the encodings
+ * it supports, by order of preference, and the server replies with the first one it supports too, or JSON.
+ * The `shm` encoding is the binary one, carried through a shared memory segment, if the transport supports it and
+ * `shm_capacity` is not zero.
+ *
+ * @returns true if the server has been asked to stop, false if the client closed the session.
+ */
+bool serve(Transport& transport, Session& session, const bool negotiable, const size_t shm_capacity = 0)
 {
-    const auto& factory = ioh::problem::ProblemRegistry<T>::instance();
+    std::unique_ptr<Codec> codec = std::make_unique<JsonCodec>();
+    while(auto payload = transport.receive()) {
+        Query query;
+        try {
+            query = codec->decode(*payload);
+        } catch (ProtocolError& ex) {
+            CLUTCHLOG(error, ex.what());
+            transport.send(codec->encode(forge_error(ex.what(), ex.code)));
+            continue;
+        }
 
-    /**** Now that we have a factory, we can list the available problems. *****/
-    if(asked["help-problems"].as<bool>()) {
-        std::cout << "Available problems:" << std::endl;
-        for(const auto& name : factory.names()) {
-            std::cout << "\t" << name << std::endl;
+        if(query.type == QueryType::Hello and negotiable) {
+            json jreply = {{"reply_type", "hello"}, {"encoding", "json"}};
+            for(const auto& encoding : query.encodings) {
+                if(encoding == "shm" and shm_capacity > 0) {
+                    std::optional<std::string> segment;
+                    try {
+                        segment = transport.share_memory(shm_capacity);
+                    } catch (std::runtime_error& ex) {
+                        CLUTCHLOG(warning, ex.what());
+                    }
+                    if(segment) {
+                        jreply["encoding"] = encoding;
+                        jreply["segment"] = *segment;
+                        jreply["capacity"] = shm_capacity;
+                        break;
+                    }
+                } else if(encoding == "binary" or encoding == "json") {
+                    jreply["encoding"] = encoding;
+                    break;
+                }
+            }
+            CLUTCHLOG(note, "Negotiated the `" << jreply["encoding"].get<std::string>() << "` encoding.");
+            if(jreply["encoding"] == "json") {
+                codec = std::make_unique<JsonCodec>();
+            } else {
+                codec = std::make_unique<BinaryCodec>(session.integer());
+            }
+            transport.send(jreply.dump());
+            continue;
+        }
+
+        bool stop = false;
+        Reply reply = session.answer(query, stop);
+        reply.id = query.id;
+        auto encoded = codec->encode(reply);
+        if(encoded.size() > transport.max_message_size()) {
+            std::ostringstream msg;
+            msg << "The reply takes " << encoded.size() << " bytes, but at most "
+                << transport.max_message_size() << " can be sent.";
+            CLUTCHLOG(error, msg.str());
+            Reply error = forge_error(msg.str(), Error::Reply_Too_Large);
+            error.id = query.id;
+            encoded = codec->encode(error);
+        }
+        transport.send(encoded);
+        if(stop) {
+            return true;
         }
-        EXIT(No_Error);
     }
-    std::shared_ptr<T> problem = factory.create( asked["problem"].as<std::string>(), asked["instance"].as<int>(), asked["dimension"].as<int>() );
-    return problem;
+    return false;
 }
 
-template<class T>
-void call(std::shared_ptr<T> problem, const cxxopts::ParseResult& asked, const json& jquery, const std::string& freply)
+/** Serve every client connecting to a Unix domain socket, each in its own thread and with its own session.
+ *
+ * A `stop` query from any client ends all the sessions.
+ */
+void serve_socket(const std::string& path, const cxxopts::ParseResult& asked, const size_t shm_capacity)
 {
-    std::vector<typename T::Type> sol = jquery["solution"];
+    UnixSocketListener listener(path);
+    std::mutex mutex;
+    std::vector<int> clients;
+    std::map<std::thread::id, std::thread> threads;
+    std::vector<std::thread::id> finished;
+
+    // Join the threads of the clients which left, so that a long-running server does not accumulate them.
+    const auto reap = [&] {
+        std::vector<std::thread> done;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for(const auto id : finished) {
+                done.push_back(std::move(threads.at(id)));
+                threads.erase(id);
+            }
+            finished.clear();
+        }
+        for(auto& thread : done) {
+            thread.join();
+        }
+    };
 
-    /***** Sanity checks. *****/
-    if(static_cast<int>(sol.size()) != asked["dimension"].as<int>()) {
-        std::ostringstream msg;
-        msg << "Received a solution of size " << sol.size() << ", which does not match the problem's dimension of " << asked["dimension"].as<int>();
-        error(freply, msg.str(), Error::Dimension_Mismatch);
-        return;
-    }
-    // TODO check domain constraints.
+    // Disconnect the remaining clients, so that their threads end.
+    const auto disconnect = [&] {
+        std::lock_guard<std::mutex> lock(mutex);
+        for(const int client : clients) {
+            shutdown(client, SHUT_RDWR);
+        }
+    };
 
-    CLUTCHLOG(debug, "Call the objective function...");
-    double fval = (*problem)(sol);
-    CLUTCHLOG(xdebug, "Result: `" << fval << "`.");
-                
-    json jreply = forge_value<typename T::Type>(fval, sol);
-    send(freply, jreply.dump());
+    // Join all threads on every way out of this function, as destroying a joinable thread terminates the server.
+    struct JoinAll {
+        std::function<void()> join;
+        ~JoinAll() { join(); }
+    } join_all{[&] {
+        disconnect();
+        reap();
+        for(auto& [id, thread] : threads) {
+            thread.join();
+        }
+    }};
+
+    CLUTCHLOG(note, "Listen to `" << path << "`.");
+    int fd;
+    while((fd = listener.accept()) >= 0) {
+        reap();
+        CLUTCHLOG(note, "Client connected.");
+        std::lock_guard<std::mutex> lock(mutex);
+        try {
+            // Sessions are created here, so that their data folders are created one after the other.
+            auto session = std::make_shared<Session>(asked);
+            clients.push_back(fd);
+            std::thread thread([&, fd, session] {
+                std::unique_ptr<SocketStream> transport;
+                try {
+                    transport = std::make_unique<SocketStream>(fd);
+                    if(serve(*transport, *session, true, shm_capacity)) {
+                        listener.shutdown();
+                        disconnect();
+                    } else {
+                        CLUTCHLOG(note, "The client closed the session.");
+                    }
+                } catch (std::exception& ex) {
+                    CLUTCHLOG(warning, ex.what());
+                }
+                // Forget the socket before closing it, as its descriptor may then be reused.
+                std::lock_guard<std::mutex> lock(mutex);
+                clients.erase(std::find(clients.begin(), clients.end(), fd));
+                if(transport) {
+                    transport->close();
+                } else {
+                    ::close(fd);
+                }
+                finished.push_back(std::this_thread::get_id());
+            });
+            threads.emplace(thread.get_id(), std::move(thread));
+        } catch (std::exception& ex) {
+            // The session or its thread could not be created: turn this client away, and serve the next ones.
+            CLUTCHLOG(error, "Cannot serve the client: " << ex.what());
+            const auto it = std::find(clients.begin(), clients.end(), fd);
+            if(it != clients.end()) {
+                clients.erase(it);
+            }
+            ::close(fd);
+        }
+    }
 }
 
 
@@ -219,12 +558,17 @@ int main(int argc, char** argv)
         /* Main */
         ("input", "Input fifo named pipe.", cxxopts::value<std::string>() )
         ("output", "Output fifo named pipe.", cxxopts::value<std::string>() )
+        ("protocol", "Protocol (`files`: the pipes are reopened for each JSON message, `stream`: the pipes stay open for the session, and messages are framed)", cxxopts::value<std::string>()->default_value("files") )
+        ("socket", "Unix domain socket on which to serve concurrent clients, instead of the named pipes (messages are framed as with the `stream` protocol)", cxxopts::value<std::string>() )
+        ("shm", "Let the socket clients negotiate the `shm` encoding, which carries the messages through shared memory", cxxopts::value<bool>() )
+        ("shm-size", "Capacity of each ring of the shared memory segments, in bytes", cxxopts::value<size_t>()->default_value("1048576") )
         ("h,help", "Print help")
         /* Problem */
         ("t,type", "Problem type (`integer` or `real`)", cxxopts::value<std::string>()/*->default_value("integer")*/ )
         ("p,problem",  "Problem name",  cxxopts::value<std::string>()->default_value("OneMax") )
         ("i,instance", "Instance identifier", cxxopts::value<int>()->default_value("0") )
         ("d,dimension", "Problem dimension", cxxopts::value<int>()->default_value("1") )
+        ("cache-size", "Number of constructed problems kept by each session, to switch between them", cxxopts::value<size_t>()->default_value("16") )
         /* Logging */
         ("f,folder", "Folder in which to store the run data.", cxxopts::value<std::string>()->default_value("ioh_experiment") )
         ("s,solver", "Name of the solver that will do the queries", cxxopts::value<std::string>()->default_value("my_solver") )
@@ -275,7 +619,7 @@ int main(int argc, char** argv)
 #endif
 
     /***********************************************************************
-     * IOH instantiations
+     * Sanity checks
      **********************************************************************/
 
     std::string type = asked["type"].as<std::string>();
@@ -284,141 +628,102 @@ int main(int argc, char** argv)
         EXIT_ON_ERROR(Invalid_Argument, "Unknown problem type: `" << type << "`");
     }
 
-    // FIXME check if IOH can have the necessary abstract interfaces here.
-    std::shared_ptr<ioh::problem::Integer> problem_int  = nullptr;
-    std::shared_ptr<ioh::problem::Real>    problem_real = nullptr;
-
-    if(type == "integer") {
-        problem_int = create<ioh::problem::Integer>(asked);
-    } else if(type == "real") {
-        problem_real = create<ioh::problem::Real>(asked);
-    }
-
-    // TODO parametrize W-model?
-
-
-    // Continue with IOH instantiations.
-    auto logger = ioh::logger::Analyzer(
-            {ioh::trigger::on_improvement},
-            {}, // additional properties // TODO FIXME find a way to handle (undeclared?) properties from the client.
-            fs::current_path(), // Not sure it would be useful to let this be a parameter, as we already have folder and the service is single-expe by design.
-            asked["folder"].as<std::string>(),
-            asked["solver"].as<std::string>(),
-            asked["metadata"].as<std::string>()
-        );
-
-
-    if(type == "integer") {
-        problem_int->attach_logger(logger);
-    } else if(type == "real") {
-        problem_real->attach_logger(logger);
+    /**** Now that we know the type, we can list the available problems. *****/
+    if(asked["help-problems"].as<bool>()) {
+        if(type == "integer") {
+            list_problems<ioh::problem::Integer>();
+        } else {
+            list_problems<ioh::problem::Real>();
+        }
+        EXIT(No_Error);
     }
 
-    /***********************************************************************
-     * Sanity checks
-     **********************************************************************/
-
-    if(not asked.count("input")) {
-        EXIT_ON_ERROR(Missing_Argument, "Missing required argument: input fifo named pipes.");
-    }
-    if(not asked.count("output")) {
-        EXIT_ON_ERROR(Missing_Argument, "Missing required argument: output fifo named pipes.");
+    if(asked["dimension"].as<int>() < 1) {
+        EXIT_ON_ERROR(Invalid_Argument, "Problem dimension cannot be < 1.");
     }
 
-    std::string finput = asked["input"].as<std::string>();
-    std::string freply = asked["output"].as<std::string>();
-
-    if(not std::filesystem::exists(finput)) {
-        EXIT_ON_ERROR(No_File, "Input fifo named pipe does not exists.");
-    }
-    if(not std::filesystem::exists(freply)) {
-        EXIT_ON_ERROR(No_File, "Output fifo named pipe does not exists.");
+    const bool known = type == "integer"
+        ? find_problem<ioh::problem::Integer>(asked["problem"].as<std::string>()).has_value()
+        : find_problem<ioh::problem::Real>(asked["problem"].as<std::string>()).has_value();
+    if(not known) {
+        EXIT_ON_ERROR(Invalid_Argument, "Unknown problem: `" << asked["problem"].as<std::string>() << "` (see --help-problems).");
     }
 
-    if(not std::filesystem::is_fifo(finput)) {
-        EXIT_ON_ERROR(Not_FIFO, "Input is not a fifo named pipe.");
-    }
-    if(not std::filesystem::is_fifo(freply)) {
-        EXIT_ON_ERROR(Not_FIFO, "Ouptut is not a fifo named pipe.");
+    std::string protocol = asked["protocol"].as<std::string>();
+    if(not (protocol == "files" or protocol == "stream")) {
+        EXIT_ON_ERROR(Invalid_Argument, "Unknown protocol: `" << protocol << "`");
     }
 
-    if(asked["dimension"].as<int>() < 1) {
-        EXIT_ON_ERROR(Invalid_Argument, "Problem dimension cannot be < 1.");
+    const size_t shm_capacity = asked["shm"].as<bool>() ? asked["shm-size"].as<size_t>() : 0;
+    if(asked["shm"].as<bool>() and shm_capacity < 8) {
+        EXIT_ON_ERROR(Invalid_Argument, "The shared memory rings should hold at least 8 bytes (see --shm-size).");
     }
-    
-    /***********************************************************************
-     * Main loop
-     **********************************************************************/
-
-    CLUTCHLOG(progress, "Start the server.");
 
-    while(true) {
+    std::string finput, freply;
+    if(not asked.count("socket")) {
+        if(not asked.count("input")) {
+            EXIT_ON_ERROR(Missing_Argument, "Missing required argument: input fifo named pipes.");
+        }
+        if(not asked.count("output")) {
+            EXIT_ON_ERROR(Missing_Argument, "Missing required argument: output fifo named pipes.");
+        }
 
-        // Blocking call on named pipes.
-        std::string data = read(finput);
+        finput = asked["input"].as<std::string>();
+        freply = asked["output"].as<std::string>();
 
-        json jquery;
-        try {
-            jquery = json::parse(data);
-        } catch (json::parse_error& ex) {
-            std::ostringstream msg;
-            msg << "JSON payload parse error at byte " << ex.byte << ".";
-            error(freply, msg.str(), Error::Payload_Parse);
-            continue;
+        if(not std::filesystem::exists(finput)) {
+            EXIT_ON_ERROR(No_File, "Input fifo named pipe does not exists.");
         }
-
-        if(not jquery.contains("query_type")) {
-            error(freply, "JSON payload does not contain a `query_type` field.", Error::Payload_Type);
-            continue;
+        if(not std::filesystem::exists(freply)) {
+            EXIT_ON_ERROR(No_File, "Output fifo named pipe does not exists.");
         }
 
-        std::string query_type = jquery["query_type"];
-
-        /**********************************************************************
-         * stop
-         *********************************************************************/
-        if(query_type == "stop") {
-            CLUTCHLOG(progress, "Been asked to exit.");
-            json jreply = forge_ack();
-            send(freply, jreply.dump());
-            break;
-
-        /**********************************************************************
-         * new_run
-         *********************************************************************/
-        } else if(query_type == "new_run") {
-            CLUTCHLOG(note, "Reset the logger for a new run.");
-            logger.reset();
-            json jreply = forge_ack();
-            send(freply, jreply.dump());
-            continue;
-
-        /**********************************************************************
-         * call
-         *********************************************************************/
-        } else if(query_type == "call") {
+        if(not std::filesystem::is_fifo(finput)) {
+            EXIT_ON_ERROR(Not_FIFO, "Input is not a fifo named pipe.");
+        }
+        if(not std::filesystem::is_fifo(freply)) {
+            EXIT_ON_ERROR(Not_FIFO, "Ouptut is not a fifo named pipe.");
+        }
+    }
 
-            if(not jquery.contains("solution")) {
-                error(freply, "Query `call` should contain a `solution` field.", Error::Payload_Incomplete);
-                continue;
-            }
+    /***********************************************************************
+     * Main loop
+     **********************************************************************/
 
-            if(type == "integer") {
-                call<ioh::problem::Integer>(problem_int, asked, jquery, freply);
-            } else if(type == "real") {
-                call<ioh::problem::Real>(problem_real, asked, jquery, freply);
-            }
+    CLUTCHLOG(progress, "Start the server.");
 
-        /**********************************************************************
-         * else
-         *********************************************************************/
+    try {
+        if(asked.count("socket")) {
+            // A client closing its socket early must not kill the server.
+            std::signal(SIGPIPE, SIG_IGN);
+            serve_socket(asked["socket"].as<std::string>(), asked, shm_capacity);
+        } else if(protocol == "files") {
+            Session session(asked);
+            // Every message is delimited by the closing of the pipes, so the session never ends.
+            FifoFiles transport(finput, freply);
+            serve(transport, session, false);
         } else {
-            std::ostringstream msg;
-            msg << "query_type `" << query_type << "` not supported.";
-            error(freply, msg.str(), Error::Not_Supported);
-            continue;
+            Session session(asked);
+            // A client closing the pipes early must not kill the server.
+            std::signal(SIGPIPE, SIG_IGN);
+            FifoStream transport(finput, freply);
+            bool stop = false;
+            while(not stop) {
+                transport.open();
+                try {
+                    stop = serve(transport, session, true);
+                } catch (std::exception& ex) {
+                    CLUTCHLOG(warning, ex.what());
+                }
+                transport.close();
+                if(not stop) {
+                    CLUTCHLOG(note, "The client closed the session.");
+                }
+            }
         }
-    } // while true
+    } catch (std::runtime_error& ex) {
+        EXIT_ON_ERROR(Unreadable, ex.what());
+    }
 
     CLUTCHLOG(progress, "Stop the server.");
     EXIT(No_Error);
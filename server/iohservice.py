@@ -37,3 +37,214 @@ def call(sol, fquery, freply):
     else:
         print("ERROR:",reply["message"])
         return None
+
+def batch(sols, fquery, freply):
+    jq = json.dumps( {"query_type":"batch", "solutions":sols}, indent=4 )
+    reply = query(jq, fquery, freply)
+    if not is_error(reply):
+        return reply["values"]
+    else:
+        print("ERROR:",reply["message"])
+        return None
+
+def problem(name, fquery, freply, instance=None, dimension=None):
+    """Switch to another problem, given by its name or its identifier.
+
+    The instance and the dimension default to the ones of the current problem.
+    """
+    jq = {"query_type": "problem", "problem": name}
+    if instance is not None:
+        jq["instance"] = instance
+    if dimension is not None:
+        jq["dimension"] = dimension
+    reply = query(json.dumps(jq, indent=4), fquery, freply)
+    if is_error(reply):
+        print("ERROR:", reply["message"])
+    return reply
+
+
+class SharedMemory:
+    """Client side of a shared memory segment of the server, see `shared_memory.hpp`.
+
+    The segment holds two rings of framed messages, one for the queries and one for the replies.
+    """
+
+    QUERIES, REPLIES = 0, 1
+
+    def __init__(self, name, capacity):
+        import mmap
+        import os
+        import struct
+        self._struct = struct
+        self.capacity = capacity
+        fd = os.open("/dev/shm/" + name.lstrip("/"), os.O_RDWR)
+        try:
+            self.map = mmap.mmap(fd, 64 + 2 * capacity)
+        finally:
+            os.close(fd)
+
+    def _counter(self, i):
+        return self._struct.unpack_from("=Q", self.map, 8 * i)[0]
+
+    def _put(self, ring, pos, data):
+        base = 64 + ring * self.capacity
+        at = pos % self.capacity
+        first = min(len(data), self.capacity - at)
+        self.map[base + at:base + at + first] = data[:first]
+        self.map[base:base + len(data) - first] = data[first:]
+
+    def _get(self, ring, pos, n):
+        base = 64 + ring * self.capacity
+        at = pos % self.capacity
+        first = min(n, self.capacity - at)
+        return self.map[base + at:base + at + first] + self.map[base:base + n - first]
+
+    def write(self, ring, payload):
+        head, tail = self._counter(2 * ring), self._counter(2 * ring + 1)
+        if self.capacity - (tail - head) < 4 + len(payload):
+            raise ValueError("The message does not fit in the shared memory ring")
+        self._put(ring, tail, self._struct.pack("<I", len(payload)) + payload)
+        self._struct.pack_into("=Q", self.map, 8 * (2 * ring + 1), tail + 4 + len(payload))
+
+    def read(self, ring):
+        head = self._counter(2 * ring)
+        size, = self._struct.unpack("<I", self._get(ring, head, 4))
+        payload = self._get(ring, head + 4, size)
+        self._struct.pack_into("=Q", self.map, 8 * (2 * ring), head + 4 + size)
+        return payload
+
+    def close(self):
+        self.map.close()
+
+
+class Stream:
+    """Client of the `stream` protocol, which keeps the named pipes open for the whole session.
+
+    Every message is prefixed by its length, as a little-endian uint32.
+    The encoding is negotiated at the start of the session: "binary" messages
+    are compact and fast to decode, "json" messages are the ones of the
+    `files` protocol.
+
+    Without a reply pipe, `fquery` is the Unix domain socket of a server started
+    with `--socket`. Such a server may also offer the "shm" encoding, if started
+    with `--shm`: the binary messages are then carried through a shared memory
+    segment, and the socket only carries one byte per message.
+    """
+
+    def __init__(self, fquery, freply=None, integer=True, encodings=("binary", "json")):
+        import struct
+        self._struct = struct
+        self.integer = integer
+        self.socket = None
+        self.shm = None
+        if freply is None:
+            import socket
+            self.socket = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+            self.socket.connect(fquery)
+            self.query = self.socket.makefile('wb')
+            self.reply = self.socket.makefile('rb')
+        else:
+            # Same order as the server, or both sides would block.
+            self.query = open(fquery, 'wb')
+            self.reply = open(freply, 'rb')
+        self.send(json.dumps({"query_type": "hello", "encodings": list(encodings)}).encode())
+        hello = json.loads(self.read())
+        self.encoding = hello["encoding"]
+        if self.encoding == "shm":
+            self.shm = SharedMemory(hello["segment"], hello["capacity"])
+
+    def send(self, payload):
+        if self.shm:
+            self.shm.write(SharedMemory.QUERIES, payload)
+            self.query.write(b"m")
+        else:
+            self.query.write(self._struct.pack("<I", len(payload)) + payload)
+        self.query.flush()
+
+    def read(self):
+        if self.shm:
+            if not self.reply.read(1):
+                raise EOFError("The server closed the session")
+            return self.shm.read(SharedMemory.REPLIES)
+        header = self.reply.read(4)
+        if len(header) < 4:
+            raise EOFError("The server closed the session")
+        size, = self._struct.unpack("<I", header)
+        return self.reply.read(size)
+
+    def exchange(self, jq, binary):
+        """Send a query, given in both encodings, and return the decoded reply."""
+        if self.encoding in ("binary", "shm"):
+            self.send(binary)
+            r = self.read()
+            if r[:1] == b"v":
+                return {"reply_type": "value", "value": self._struct.unpack("=d", r[1:9])[0]}
+            elif r[:1] == b"V":
+                n = (len(r) - 1) // 8
+                return {"reply_type": "values", "values": list(self._struct.unpack("={}d".format(n), r[1:]))}
+            elif r[:1] == b"a":
+                return {"reply_type": "ack"}
+            return {"reply_type": "error", "code": r[1], "message": r[2:].decode()}
+        self.send(json.dumps(jq).encode())
+        return json.loads(self.read())
+
+    def call(self, sol):
+        fmt = "=c{}{}".format(len(sol), "i" if self.integer else "d")
+        reply = self.exchange({"query_type": "call", "solution": sol}, self._struct.pack(fmt, b"c", *sol))
+        if not is_error(reply):
+            return reply["value"]
+        else:
+            print("ERROR:", reply["message"])
+            return None
+
+    def batch(self, sols):
+        fmt = "=cI{}{}".format(sum(len(sol) for sol in sols), "i" if self.integer else "d")
+        flat = [v for sol in sols for v in sol]
+        reply = self.exchange({"query_type": "batch", "solutions": sols}, self._struct.pack(fmt, b"b", len(sols), *flat))
+        if not is_error(reply):
+            return reply["values"]
+        else:
+            print("ERROR:", reply["message"])
+            return None
+
+    def new_run(self):
+        return self.exchange({"query_type": "new_run"}, b"r")
+
+    def session(self, jq):
+        """Send a query managing the session, which is always in JSON."""
+        reply = self.exchange(jq, json.dumps(jq).encode())
+        if is_error(reply):
+            print("ERROR:", reply["message"])
+        return reply
+
+    def problem(self, name, instance=None, dimension=None):
+        """Switch to another problem, given by its name or its identifier.
+
+        The instance and the dimension default to the ones of the current problem.
+        """
+        jq = {"query_type": "problem", "problem": name}
+        if instance is not None:
+            jq["instance"] = instance
+        if dimension is not None:
+            jq["dimension"] = dimension
+        return self.session(jq)
+
+    def reset(self):
+        return self.session({"query_type": "reset"})
+
+    def attach_logger(self):
+        return self.session({"query_type": "attach_logger"})
+
+    def detach_logger(self):
+        return self.session({"query_type": "detach_logger"})
+
+    def stop(self):
+        return self.exchange({"query_type": "stop"}, b"s")
+
+    def close(self):
+        self.query.close()
+        self.reply.close()
+        if self.shm:
+            self.shm.close()
+        if self.socket:
+            self.socket.close()
@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+"""Load test of ioh-server: reports the round-trip latency and the number of evaluations per second."""
+import argparse
+import json
+import random
+import statistics
+import time
+
+import iohservice
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("query", help="Query fifo named pipe, or Unix domain socket")
+    parser.add_argument("reply", nargs="?", help="Reply fifo named pipe, none for a socket")
+    parser.add_argument("-t", "--type", choices=["integer", "real"], default="integer", help="Problem type")
+    parser.add_argument("-d", "--dimension", type=int, default=10, help="Problem dimension")
+    parser.add_argument("-n", "--evaluations", type=int, default=10000, help="Number of evaluations")
+    parser.add_argument("--protocol", choices=["files", "stream"], default="stream", help="Protocol of the server, sockets always stream")
+    parser.add_argument("--encoding", choices=["binary", "json", "shm"], default="binary", help="Encoding, for the stream protocol (shm needs a socket)")
+    parser.add_argument("-b", "--batch", type=int, default=1, help="Number of solutions per query")
+    parser.add_argument("--stop", action="store_true", help="Ask the server to stop at the end")
+    asked = parser.parse_args()
+
+    integer = asked.type == "integer"
+    solutions = [
+        [random.randint(0, 1) if integer else random.uniform(-5, 5) for _ in range(asked.dimension)]
+        for _ in range(min(asked.evaluations, 1000))
+    ]
+
+    if asked.protocol == "stream":
+        client = iohservice.Stream(asked.query, asked.reply, integer, [asked.encoding])
+        call, batch = client.call, client.batch
+    else:
+        def query(jq):
+            with open(asked.query, 'w') as fd:
+                fd.write(json.dumps(jq))
+            with open(asked.reply) as fd:
+                return json.loads(fd.read())
+
+        def call(sol):
+            return query({"query_type": "call", "solution": sol})["value"]
+
+        def batch(sols):
+            return query({"query_type": "batch", "solutions": sols})["values"]
+
+    latencies = []
+    start = time.perf_counter()
+    for i in range(0, asked.evaluations, asked.batch):
+        before = time.perf_counter()
+        if asked.batch == 1:
+            call(solutions[i % len(solutions)])
+        else:
+            batch([solutions[(i + j) % len(solutions)] for j in range(min(asked.batch, asked.evaluations - i))])
+        latencies.append(time.perf_counter() - before)
+    elapsed = time.perf_counter() - start
+
+    if asked.stop:
+        if asked.protocol == "stream":
+            client.stop()
+        else:
+            query({"query_type": "stop"})
+    if asked.protocol == "stream":
+        client.close()
+
+    latencies.sort()
+    us = lambda s: s * 1e6
+    print("protocol: {}{}, {} solution(s) per query".format(
+        asked.protocol, " ({})".format(client.encoding) if asked.protocol == "stream" else "", asked.batch))
+    print("evaluations: {} in {:.3f} s, {:.0f} evaluations/s".format(asked.evaluations, elapsed, asked.evaluations / elapsed))
+    print("latency (us): mean {:.1f}, median {:.1f}, p99 {:.1f}, max {:.1f}".format(
+        us(statistics.mean(latencies)), us(latencies[len(latencies) // 2]),
+        us(latencies[int(len(latencies) * 0.99)]), us(latencies[-1])))
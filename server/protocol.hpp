@@ -0,0 +1,408 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if __cplusplus == 202002L
+#include <chrono>
+#else
+#include <ctime>
+#endif
+
+#include <nlohmann/json.hpp>
+using json = nlohmann::json;
+
+//! Error codes returned on exit, and sent back in error replies.
+enum class Error : unsigned char {
+    No_Error = 0,
+    No_File = 2, // ENOENT
+    Invalid_Argument = 22, // EINVAL
+    Not_FIFO = 60, // ENOSTR
+    Unreadable = 77, // EBADFD
+    Missing_Argument = 132,
+    Payload_Parse,
+    Payload_Type,
+    Payload_Incomplete,
+    Dimension_Mismatch,
+    Not_Supported,
+    Unknown_Problem,
+    Reply_Too_Large,
+    Unknown = 255
+};
+
+//! Kinds of queries, sent by the (solver) client.
+enum class QueryType { Call, Batch, NewRun, Stop, Hello, Problem, Reset, AttachLogger, DetachLogger };
+
+//! A decoded query.
+struct Query {
+    QueryType type;
+    //! The solution to evaluate, for a `call`.
+    std::vector<double> solution;
+    //! The solutions to evaluate, in order, for a `batch`.
+    std::vector<std::vector<double>> solutions;
+    //! The encodings supported by the client, by order of preference, for a `hello`.
+    std::vector<std::string> encodings;
+    //! The name of the problem to switch to, for a `problem`, unless given by its identifier.
+    std::string problem;
+    //! The identifier of the problem to switch to, for a `problem`.
+    std::optional<int> problem_id;
+    //! The instance of the problem to switch to, for a `problem`, the current one if not given.
+    std::optional<int> instance;
+    //! The dimension of the problem to switch to, for a `problem`, the current one if not given.
+    std::optional<int> dimension;
+    //! The identifier of the query, sent back in the reply.
+    std::optional<long> id;
+};
+
+//! Kinds of replies, sent by the (problem) server.
+enum class ReplyType { Value, Values, Ack, Error };
+
+//! A reply, to be encoded.
+struct Reply {
+    ReplyType type;
+    //! The objective function value, for a `value`.
+    double value = 0;
+    //! The evaluated solution, for a `value`.
+    std::vector<double> solution;
+    //! The objective function values, for a `values`.
+    std::vector<double> values;
+    //! The description of the error, for an `error`.
+    std::string message;
+    //! The code of the error, for an `error`.
+    Error code = Error::Unknown;
+    //! The identifier of the related query.
+    std::optional<long> id;
+};
+
+//! Thrown when a payload cannot be decoded.
+struct ProtocolError : std::runtime_error {
+    Error code;
+    ProtocolError(const std::string& msg, const Error code) : std::runtime_error(msg), code(code) {}
+};
+
+inline Reply forge_ack()
+{
+    return {ReplyType::Ack};
+}
+
+inline Reply forge_error(const std::string& msg, const Error code = Error::Unknown)
+{
+    Reply reply{ReplyType::Error};
+    reply.message = msg;
+    reply.code = code;
+    return reply;
+}
+
+inline Reply forge_value(const double val, std::vector<double> sol)
+{
+    Reply reply{ReplyType::Value, val, std::move(sol)};
+    return reply;
+}
+
+inline Reply forge_values(std::vector<double> vals)
+{
+    Reply reply{ReplyType::Values};
+    reply.values = std::move(vals);
+    return reply;
+}
+
+inline std::string timestamp()
+{
+#if __cplusplus == 202002L
+    const auto now = std::chrono::system_clock::now();
+    return std::format("{:%FT%TZ}", now);
+#else
+    time_t now;
+    time(&now);
+    char buf[sizeof "2021-12-21T22:32:09Z"];
+    strftime(buf, sizeof buf, "%FT%TZ", gmtime(&now));
+    // If a  compiler doesn't support %F or %T, we can fallback to:
+    //strftime(buf, sizeof buf, "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+    return buf;
+#endif
+}
+
+//! Encoding of the messages, once a session is established.
+class Codec {
+public:
+    virtual ~Codec() = default;
+
+    //! Name of the encoding, as negotiated with the client.
+    virtual std::string name() const = 0;
+
+    //! Decode a query, throws a ProtocolError if the payload is malformed.
+    virtual Query decode(const std::string& payload) const = 0;
+
+    //! Encode a reply.
+    virtual std::string encode(const Reply& reply) const = 0;
+};
+
+/** JSON messages, as described by `ioh-query.schema.yaml` and `ioh-reply.schema.yaml`.
+ *
+ * This is the encoding of the legacy protocol, and the fallback of the stream protocol.
+ */
+class JsonCodec : public Codec {
+public:
+    std::string name() const override { return "json"; }
+
+    Query decode(const std::string& payload) const override
+    {
+        json jquery;
+        try {
+            jquery = json::parse(payload);
+        } catch (json::parse_error& ex) {
+            std::ostringstream msg;
+            msg << "JSON payload parse error at byte " << ex.byte << ".";
+            throw ProtocolError(msg.str(), Error::Payload_Parse);
+        }
+        return decode(jquery);
+    }
+
+    //! Decode an already parsed query.
+    Query decode(const json& jquery) const
+    {
+        if(not jquery.is_object() or not jquery.contains("query_type")) {
+            throw ProtocolError("JSON payload does not contain a `query_type` field.", Error::Payload_Type);
+        }
+
+        Query query{QueryType::Call};
+        if(jquery.contains("id") and jquery["id"].is_number_integer()) {
+            query.id = jquery["id"].get<long>();
+        }
+
+        const std::string query_type = jquery["query_type"];
+        if(query_type == "stop") {
+            query.type = QueryType::Stop;
+        } else if(query_type == "new_run") {
+            query.type = QueryType::NewRun;
+        } else if(query_type == "hello") {
+            query.type = QueryType::Hello;
+            try {
+                query.encodings = jquery.value("encodings", std::vector<std::string>{});
+            } catch (json::exception&) {
+                throw ProtocolError("The `encodings` field should be an array of strings.", Error::Payload_Type);
+            }
+        } else if(query_type == "problem") {
+            query.type = QueryType::Problem;
+            if(not jquery.contains("problem")) {
+                throw ProtocolError("Query `problem` should contain a `problem` field.", Error::Payload_Incomplete);
+            }
+            if(jquery["problem"].is_number_integer()) {
+                query.problem_id = jquery["problem"].get<int>();
+            } else if(jquery["problem"].is_string()) {
+                query.problem = jquery["problem"].get<std::string>();
+            } else {
+                throw ProtocolError("The `problem` field should be a name or an identifier.", Error::Payload_Type);
+            }
+            for(const auto& [field, value] : {std::pair{"instance", &query.instance}, std::pair{"dimension", &query.dimension}}) {
+                if(jquery.contains(field)) {
+                    if(not jquery[field].is_number_integer()) {
+                        std::ostringstream msg;
+                        msg << "The `" << field << "` field should be an integer.";
+                        throw ProtocolError(msg.str(), Error::Payload_Type);
+                    }
+                    *value = jquery[field].get<int>();
+                }
+            }
+        } else if(query_type == "reset") {
+            query.type = QueryType::Reset;
+        } else if(query_type == "attach_logger") {
+            query.type = QueryType::AttachLogger;
+        } else if(query_type == "detach_logger") {
+            query.type = QueryType::DetachLogger;
+        } else if(query_type == "call") {
+            if(not jquery.contains("solution")) {
+                throw ProtocolError("Query `call` should contain a `solution` field.", Error::Payload_Incomplete);
+            }
+            try {
+                query.solution = jquery["solution"].get<std::vector<double>>();
+            } catch (json::exception&) {
+                throw ProtocolError("The `solution` field should be an array of numbers.", Error::Payload_Type);
+            }
+        } else if(query_type == "batch") {
+            query.type = QueryType::Batch;
+            if(not jquery.contains("solutions")) {
+                throw ProtocolError("Query `batch` should contain a `solutions` field.", Error::Payload_Incomplete);
+            }
+            try {
+                query.solutions = jquery["solutions"].get<std::vector<std::vector<double>>>();
+            } catch (json::exception&) {
+                throw ProtocolError("The `solutions` field should be an array of arrays of numbers.", Error::Payload_Type);
+            }
+        } else {
+            std::ostringstream msg;
+            msg << "query_type `" << query_type << "` not supported.";
+            throw ProtocolError(msg.str(), Error::Not_Supported);
+        }
+        return query;
+    }
+
+    std::string encode(const Reply& reply) const override
+    {
+        json jreply = {
+            {"remarks", "ioh-server v0.2.0"},
+            {"timestamp", timestamp()}
+        };
+        if(reply.id) {
+            jreply["id"] = *reply.id;
+        }
+        switch(reply.type) {
+            case ReplyType::Value:
+                jreply["reply_type"] = "value";
+                jreply["value"] = reply.value;
+                jreply["solution"] = reply.solution;
+                break;
+            case ReplyType::Values:
+                jreply["reply_type"] = "values";
+                jreply["values"] = reply.values;
+                break;
+            case ReplyType::Ack:
+                jreply["reply_type"] = "ack";
+                break;
+            case ReplyType::Error:
+                jreply["reply_type"] = "error";
+                jreply["message"] = reply.message;
+                jreply["code"] = reply.code;
+                break;
+        }
+        return jreply.dump();
+    }
+};
+
+/** Compact binary messages, in the native byte order of the host.
+ *
+ * A query starts with a tag byte:
+ * - `c`: call, followed by the variables of the solution, as int32 for integer problems, or float64 for real ones,
+ * - `b`: batch, followed by the number of solutions as uint32, then their variables, solution after solution,
+ * - `r`: new_run,
+ * - `s`: stop.
+ *
+ * A reply starts with a tag byte:
+ * - `v`: value, followed by the float64 value,
+ * - `V`: values, followed by the float64 values,
+ * - `a`: ack,
+ * - `e`: error, followed by the code byte, then the message.
+ *
+ * The number of variables is given by the length of the frame, and the solution is not sent back.
+ *
+ * A payload starting with `{` is a JSON query, so that a `hello` can always renegotiate the encoding, and so that the
+ * queries managing the session (`problem`, `reset`, `attach_logger` and `detach_logger`) need no binary form.
+ */
+class BinaryCodec : public Codec {
+protected:
+    //! Are the variables int32, rather than float64?
+    bool integer_;
+
+    //! Decode the variables from the given offset of the payload to its end.
+    template<class T>
+    static void decode_variables(const std::string& payload, const size_t offset, std::vector<double>& solution)
+    {
+        const size_t n = (payload.size() - offset) / sizeof(T);
+        if((payload.size() - offset) % sizeof(T) != 0) {
+            throw ProtocolError("Binary payload size is not a multiple of the variables size.", Error::Payload_Parse);
+        }
+        solution.resize(n);
+        for(size_t i = 0; i < n; ++i) {
+            T v;
+            std::memcpy(&v, payload.data() + offset + i * sizeof(T), sizeof(T));
+            solution[i] = static_cast<double>(v);
+        }
+    }
+
+    //! Decode the rows of a batch.
+    void decode_batch(const std::string& payload, std::vector<std::vector<double>>& solutions) const
+    {
+        uint32_t count;
+        if(payload.size() < 1 + sizeof count) {
+            throw ProtocolError("Binary batch payload misses the number of solutions.", Error::Payload_Incomplete);
+        }
+        std::memcpy(&count, payload.data() + 1, sizeof count);
+
+        std::vector<double> all;
+        if(integer_) {
+            decode_variables<int32_t>(payload, 1 + sizeof count, all);
+        } else {
+            decode_variables<double>(payload, 1 + sizeof count, all);
+        }
+        if(count == 0 or all.size() % count != 0) {
+            throw ProtocolError("Binary batch payload size does not match its number of solutions.", Error::Payload_Parse);
+        }
+
+        const size_t n = all.size() / count;
+        solutions.resize(count);
+        for(size_t i = 0; i < count; ++i) {
+            solutions[i].assign(all.begin() + i * n, all.begin() + (i + 1) * n);
+        }
+    }
+
+public:
+    explicit BinaryCodec(const bool integer) : integer_(integer) {}
+
+    std::string name() const override { return "binary"; }
+
+    Query decode(const std::string& payload) const override
+    {
+        if(payload.empty()) {
+            throw ProtocolError("Empty binary payload.", Error::Payload_Type);
+        }
+        Query query{QueryType::Call};
+        switch(payload[0]) {
+            case '{':
+                return JsonCodec().decode(payload);
+            case 'c':
+                if(integer_) {
+                    decode_variables<int32_t>(payload, 1, query.solution);
+                } else {
+                    decode_variables<double>(payload, 1, query.solution);
+                }
+                break;
+            case 'b':
+                query.type = QueryType::Batch;
+                decode_batch(payload, query.solutions);
+                break;
+            case 'r':
+                query.type = QueryType::NewRun;
+                break;
+            case 's':
+                query.type = QueryType::Stop;
+                break;
+            default: {
+                std::ostringstream msg;
+                msg << "Binary query tag `" << payload[0] << "` not supported.";
+                throw ProtocolError(msg.str(), Error::Not_Supported);
+            }
+        }
+        return query;
+    }
+
+    std::string encode(const Reply& reply) const override
+    {
+        std::string payload;
+        switch(reply.type) {
+            case ReplyType::Value:
+                payload.resize(1 + sizeof(double));
+                payload[0] = 'v';
+                std::memcpy(&payload[1], &reply.value, sizeof(double));
+                break;
+            case ReplyType::Values:
+                payload.resize(1 + reply.values.size() * sizeof(double));
+                payload[0] = 'V';
+                std::memcpy(&payload[1], reply.values.data(), reply.values.size() * sizeof(double));
+                break;
+            case ReplyType::Ack:
+                payload = "a";
+                break;
+            case ReplyType::Error:
+                payload = "e";
+                payload.push_back(static_cast<char>(reply.code));
+                payload += reply.message;
+                break;
+        }
+        return payload;
+    }
+};
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+/** A shared memory segment holding two ring buffers of framed messages, one for the queries and one for the
+ * replies.
+ *
+ * The segment starts with a header of five native uint64: the number of bytes consumed from the query ring, and
+ * produced into it, then the same two counters for the reply ring, then the capacity of each ring. The query ring
+ * follows, at offset 64, then the reply ring. In a ring, each message is prefixed by its length as a little-endian
+ * uint32, and wraps around the end of the ring.
+ *
+ * The rings carry the payloads, while a byte sent on a socket signals each message, so that neither side has to
+ * poll the counters.
+ */
+class SharedMemory {
+protected:
+    static constexpr size_t header_size = 64;
+
+    std::string name_;
+    size_t capacity_;
+    size_t size_;
+    char* base_ = nullptr;
+
+    std::atomic<uint64_t>& counter(const size_t i) const
+    {
+        return *reinterpret_cast<std::atomic<uint64_t>*>(base_ + i * sizeof(uint64_t));
+    }
+
+    char* ring(const size_t i) const { return base_ + header_size + i * capacity_; }
+
+    //! Copy n bytes into a ring at position pos, wrapping around its end.
+    void put(char* ring, const uint64_t pos, const char* data, const size_t n) const
+    {
+        const size_t at = pos % capacity_;
+        const size_t first = std::min(n, capacity_ - at);
+        std::memcpy(ring + at, data, first);
+        std::memcpy(ring, data + first, n - first);
+    }
+
+    //! Copy n bytes out of a ring at position pos, wrapping around its end.
+    void get(const char* ring, const uint64_t pos, char* data, const size_t n) const
+    {
+        const size_t at = pos % capacity_;
+        const size_t first = std::min(n, capacity_ - at);
+        std::memcpy(data, ring + at, first);
+        std::memcpy(data + first, ring, n - first);
+    }
+
+public:
+    //! Indices of the rings.
+    enum Ring : size_t { Queries = 0, Replies = 1 };
+
+    //! Create a new segment, with rings of the given capacity.
+    SharedMemory(std::string name, const size_t capacity)
+        : name_(std::move(name)), capacity_(capacity), size_(header_size + 2 * capacity)
+    {
+        if(capacity_ < 8) {
+            throw std::runtime_error("Shared memory rings should hold at least 8 bytes.");
+        }
+        const int fd = shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if(fd < 0) {
+            throw std::runtime_error("Shared memory segment `" + name_ + "` cannot be created.");
+        }
+        if(ftruncate(fd, static_cast<off_t>(size_)) != 0) {
+            ::close(fd);
+            shm_unlink(name_.c_str());
+            throw std::runtime_error("Shared memory segment `" + name_ + "` cannot be sized.");
+        }
+        void* base = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if(base == MAP_FAILED) {
+            shm_unlink(name_.c_str());
+            throw std::runtime_error("Shared memory segment `" + name_ + "` cannot be mapped.");
+        }
+        base_ = static_cast<char*>(base);
+        std::memset(base_, 0, header_size);
+        counter(4).store(capacity_);
+    }
+
+    SharedMemory(const SharedMemory&) = delete;
+    SharedMemory& operator=(const SharedMemory&) = delete;
+
+    ~SharedMemory()
+    {
+        munmap(base_, size_);
+        shm_unlink(name_.c_str());
+    }
+
+    const std::string& name() const { return name_; }
+
+    size_t capacity() const { return capacity_; }
+
+    //! Append a message to a ring, throws if it does not fit in the free space.
+    void write(const Ring r, const std::string& msg)
+    {
+        auto& head = counter(2 * r);
+        auto& tail = counter(2 * r + 1);
+        const uint64_t pos = tail.load(std::memory_order_relaxed);
+        const uint64_t used = pos - head.load(std::memory_order_acquire);
+        if(used > capacity_) {
+            throw std::runtime_error("The shared memory ring counters are corrupted.");
+        }
+        if(capacity_ - used < 4 + msg.size()) {
+            throw std::runtime_error("The message does not fit in the shared memory ring.");
+        }
+        const auto size = static_cast<uint32_t>(msg.size());
+        const char header[4] = {
+            static_cast<char>(size),
+            static_cast<char>(size >> 8),
+            static_cast<char>(size >> 16),
+            static_cast<char>(size >> 24)
+        };
+        put(ring(r), pos, header, sizeof header);
+        put(ring(r), pos + sizeof header, msg.data(), msg.size());
+        tail.store(pos + sizeof header + msg.size(), std::memory_order_release);
+    }
+
+    //! Does a message of the given size fit in an empty ring?
+    bool fits(const size_t size) const { return size <= capacity_ - 4; }
+
+    /** Take the next message out of a ring, throws if there is none.
+     *
+     * The counters and the length prefixes are written by the client, so they are checked against the capacity of
+     * the ring before anything is copied.
+     */
+    std::string read(const Ring r)
+    {
+        auto& head = counter(2 * r);
+        auto& tail = counter(2 * r + 1);
+        const uint64_t pos = head.load(std::memory_order_relaxed);
+        const uint64_t available = tail.load(std::memory_order_acquire) - pos;
+        if(available > capacity_) {
+            throw std::runtime_error("The shared memory ring counters are corrupted.");
+        }
+
+        unsigned char header[4];
+        if(available < sizeof header) {
+            throw std::runtime_error("The shared memory ring holds no message.");
+        }
+        get(ring(r), pos, reinterpret_cast<char*>(header), sizeof header);
+        const uint32_t size = static_cast<uint32_t>(header[0])
+            | static_cast<uint32_t>(header[1]) << 8
+            | static_cast<uint32_t>(header[2]) << 16
+            | static_cast<uint32_t>(header[3]) << 24;
+        if(not fits(size)) {
+            throw std::runtime_error("The shared memory ring holds a message larger than the ring.");
+        }
+        if(available < sizeof header + size) {
+            throw std::runtime_error("The shared memory ring holds a truncated message.");
+        }
+
+        std::string msg(size, '\0');
+        get(ring(r), pos + sizeof header, msg.data(), size);
+        head.store(pos + sizeof header + size, std::memory_order_release);
+        return msg;
+    }
+};
@@ -0,0 +1,391 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <clutchlog/clutchlog.h>
+
+#include "shared_memory.hpp"
+
+//! Strip spaces around the input string.
+inline std::string strip(std::string s)
+{
+    s.erase(std::find_if( s.rbegin(), s.rend(),
+            [](int ch) { return !std::isspace(ch); }
+        ).base(), s.end());
+    return s;
+}
+
+//! Carry messages between the client and the server.
+class Transport {
+public:
+    virtual ~Transport() = default;
+
+    //! Wait for a client to open a session.
+    virtual void open() {}
+
+    //! End the session.
+    virtual void close() {}
+
+    //! Wait for the next message, returns nothing once the client closed the session.
+    virtual std::optional<std::string> receive() = 0;
+
+    //! Send a message.
+    virtual void send(const std::string& msg) = 0;
+
+    //! The size of the largest message which can be sent.
+    virtual size_t max_message_size() const { return std::string().max_size(); }
+
+    /** Carry the next messages through a shared memory segment, once the current message is sent.
+     *
+     * The segment lasts for the rest of the session.
+     *
+     * @returns the name of the segment, or nothing if the transport does not support shared memory.
+     */
+    virtual std::optional<std::string> share_memory(const size_t /*capacity*/) { return std::nullopt; }
+};
+
+/** Legacy transport, which opens the named pipes for every message.
+ *
+ * A message is delimited by the closing of the pipe. Every message costs two opens and two closes of each pipe
+ * on each side, which caps the throughput at a few thousand messages per second.
+ */
+class FifoFiles : public Transport {
+protected:
+    std::string input_;
+    std::string output_;
+
+public:
+    FifoFiles(std::string input, std::string output) : input_(std::move(input)), output_(std::move(output)) {}
+
+    std::optional<std::string> receive() override
+    {
+        CLUTCHLOG(debug, "Wait for query... ");
+        std::ifstream ifs( input_ );
+        if(ifs.fail()) {
+            throw std::runtime_error("Input fifo named pipe cannot be read.");
+        }
+        std::stringstream datas;
+        datas << ifs.rdbuf();
+        ifs.close();
+        std::string data = strip(datas.str());
+        CLUTCHLOG(xdebug, "Received: `" << data << "`");
+        return data;
+    }
+
+    void send(const std::string& msg) override
+    {
+        CLUTCHLOG(debug, "Send response...");
+        std::ofstream ofs( output_ );
+        if(ofs.fail()) {
+            throw std::runtime_error("Output fifo named pipe cannot be written.");
+        }
+        ofs << msg << std::endl;
+        ofs.close();
+        CLUTCHLOG(xdebug, "Sent: `" << msg << "`.");
+    }
+};
+
+/** Messages framed in a stream, each prefixed by its length as a little-endian uint32.
+ *
+ * The streams stay open for the whole session.
+ */
+class FramedStream : public Transport {
+public:
+    //! The size of the largest frame, larger frames are refused before being allocated.
+    static constexpr uint32_t max_frame_size = 64u << 20;
+
+protected:
+    FILE* in_ = nullptr;
+    FILE* out_ = nullptr;
+
+    //! Read exactly n bytes, returns false at the end of the stream.
+    bool read_exactly(char* data, const size_t n)
+    {
+        return std::fread(data, 1, n, in_) == n;
+    }
+
+public:
+    ~FramedStream() override { FramedStream::close(); }
+
+    void close() override
+    {
+        if(in_ != nullptr) {
+            std::fclose(in_);
+        }
+        if(out_ != nullptr) {
+            std::fclose(out_);
+        }
+        in_ = out_ = nullptr;
+    }
+
+    std::optional<std::string> receive() override
+    {
+        CLUTCHLOG(debug, "Wait for query... ");
+        unsigned char header[4];
+        if(not read_exactly(reinterpret_cast<char*>(header), sizeof header)) {
+            return std::nullopt;
+        }
+        const uint32_t size = static_cast<uint32_t>(header[0])
+            | static_cast<uint32_t>(header[1]) << 8
+            | static_cast<uint32_t>(header[2]) << 16
+            | static_cast<uint32_t>(header[3]) << 24;
+        if(size > max_frame_size) {
+            throw std::runtime_error("The query frame is larger than " + std::to_string(max_frame_size) + " bytes.");
+        }
+
+        std::string data(size, '\0');
+        if(not read_exactly(data.data(), size)) {
+            return std::nullopt;
+        }
+        CLUTCHLOG(xdebug, "Received " << size << " bytes.");
+        return data;
+    }
+
+    void send(const std::string& msg) override
+    {
+        CLUTCHLOG(debug, "Send response...");
+        const auto size = static_cast<uint32_t>(msg.size());
+        const unsigned char header[4] = {
+            static_cast<unsigned char>(size),
+            static_cast<unsigned char>(size >> 8),
+            static_cast<unsigned char>(size >> 16),
+            static_cast<unsigned char>(size >> 24)
+        };
+        if(std::fwrite(header, 1, sizeof header, out_) != sizeof header
+           or std::fwrite(msg.data(), 1, msg.size(), out_) != msg.size()
+           or std::fflush(out_) != 0) {
+            throw std::runtime_error("Output stream cannot be written.");
+        }
+        CLUTCHLOG(xdebug, "Sent " << size << " bytes.");
+    }
+
+    size_t max_message_size() const override { return max_frame_size; }
+};
+
+/** Framed messages through named pipes, which stay open for the whole session.
+ *
+ * The client opens the query pipe for writing, then the reply pipe for reading. The session ends when the client
+ * closes the query pipe.
+ */
+class FifoStream : public FramedStream {
+protected:
+    std::string input_;
+    std::string output_;
+
+public:
+    FifoStream(std::string input, std::string output) : input_(std::move(input)), output_(std::move(output)) {}
+
+    void open() override
+    {
+        CLUTCHLOG(debug, "Wait for a client...");
+        // Blocks until the client opens the pipes, in the same order.
+        in_ = std::fopen(input_.c_str(), "rb");
+        if(in_ == nullptr) {
+            throw std::runtime_error("Input fifo named pipe cannot be read.");
+        }
+        out_ = std::fopen(output_.c_str(), "wb");
+        if(out_ == nullptr) {
+            throw std::runtime_error("Output fifo named pipe cannot be written.");
+        }
+        CLUTCHLOG(note, "Client connected.");
+    }
+};
+
+/** Framed messages through a connected Unix domain socket.
+ *
+ * The messages can then be carried through shared memory, see \ref share_memory, in which case each message is
+ * signaled by a single byte on the socket.
+ */
+class SocketStream : public FramedStream {
+protected:
+    //! The shared memory, if any.
+    std::unique_ptr<SharedMemory> shm_;
+
+    //! Are the messages carried by the shared memory?
+    bool shared_ = false;
+
+    //! Do the messages switch to the shared memory after the next one?
+    bool sharing_ = false;
+
+public:
+    //! Take ownership of a connected socket. If it cannot be opened, this throws, and the socket stays with the caller.
+    explicit SocketStream(const int fd)
+    {
+        const int out_fd = dup(fd);
+        out_ = out_fd < 0 ? nullptr : fdopen(out_fd, "wb");
+        if(out_ == nullptr) {
+            if(out_fd >= 0) {
+                ::close(out_fd);
+            }
+            throw std::runtime_error("Socket cannot be opened.");
+        }
+        in_ = fdopen(fd, "rb");
+        if(in_ == nullptr) {
+            std::fclose(out_);
+            out_ = nullptr;
+            throw std::runtime_error("Socket cannot be opened.");
+        }
+    }
+
+    void close() override
+    {
+        shared_ = sharing_ = false;
+        shm_.reset();
+        FramedStream::close();
+    }
+
+    std::optional<std::string> share_memory(const size_t capacity) override
+    {
+        if(shm_) {
+            return shm_->name();
+        }
+        static std::atomic<unsigned> count{0};
+        std::ostringstream name;
+        name << "/ioh-server-" << getpid() << "-" << count++;
+        shm_ = std::make_unique<SharedMemory>(name.str(), capacity);
+        sharing_ = true;
+        CLUTCHLOG(note, "Share memory through `" << shm_->name() << "`.");
+        return shm_->name();
+    }
+
+    std::optional<std::string> receive() override
+    {
+        if(not shared_) {
+            return FramedStream::receive();
+        }
+        CLUTCHLOG(debug, "Wait for query... ");
+        if(std::fgetc(in_) == EOF) {
+            return std::nullopt;
+        }
+        return shm_->read(SharedMemory::Queries);
+    }
+
+    size_t max_message_size() const override
+    {
+        return shared_ ? shm_->capacity() - 4 : FramedStream::max_message_size();
+    }
+
+    void send(const std::string& msg) override
+    {
+        if(not shared_) {
+            FramedStream::send(msg);
+            shared_ = sharing_;
+            return;
+        }
+        CLUTCHLOG(debug, "Send response...");
+        shm_->write(SharedMemory::Replies, msg);
+        if(std::fputc('m', out_) == EOF or std::fflush(out_) != 0) {
+            throw std::runtime_error("Output stream cannot be written.");
+        }
+    }
+};
+
+//! Accept clients on a Unix domain socket.
+/** Accept the clients of a Unix socket.
+ *
+ * The listener waits with poll on the socket and on a self-pipe, so that \ref shutdown unblocks \ref accept on
+ * every POSIX system, rather than relying on shutting the listening socket down, which only Linux supports.
+ */
+class UnixSocketListener {
+protected:
+    std::string path_;
+    int fd_ = -1;
+
+    //! The self-pipe: shutdown writes to stop_[1], accept polls stop_[0].
+    int stop_[2] = {-1, -1};
+
+    void close_all()
+    {
+        for(const int fd : {fd_, stop_[0], stop_[1]}) {
+            if(fd >= 0) {
+                ::close(fd);
+            }
+        }
+    }
+
+public:
+    explicit UnixSocketListener(std::string path) : path_(std::move(path))
+    {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        if(path_.size() >= sizeof address.sun_path) {
+            throw std::runtime_error("Socket path is too long.");
+        }
+        std::strncpy(address.sun_path, path_.c_str(), sizeof address.sun_path - 1);
+
+        // The listening socket does not block, in case a client leaves between poll and accept.
+        fd_ = socket(AF_UNIX, SOCK_STREAM, 0);
+        if(fd_ < 0
+           or fcntl(fd_, F_SETFL, fcntl(fd_, F_GETFL) | O_NONBLOCK) != 0
+           or bind(fd_, reinterpret_cast<sockaddr*>(&address), sizeof address) != 0
+           or listen(fd_, SOMAXCONN) != 0
+           or pipe(stop_) != 0
+           or fcntl(stop_[1], F_SETFL, O_NONBLOCK) != 0) {
+            close_all();
+            throw std::runtime_error("Socket `" + path_ + "` cannot be listened to.");
+        }
+    }
+
+    UnixSocketListener(const UnixSocketListener&) = delete;
+    UnixSocketListener& operator=(const UnixSocketListener&) = delete;
+
+    ~UnixSocketListener()
+    {
+        close_all();
+        unlink(path_.c_str());
+    }
+
+    //! Wait for a client, returns its connected socket, or -1 once the listener is shut down or fails.
+    int accept()
+    {
+        pollfd fds[2] = {{fd_, POLLIN, 0}, {stop_[0], POLLIN, 0}};
+        while(true) {
+            if(poll(fds, 2, -1) < 0) {
+                if(errno == EINTR) {
+                    continue;
+                }
+                return -1;
+            }
+            if(fds[1].revents != 0) {
+                return -1;
+            }
+            if(fds[0].revents & (POLLERR | POLLHUP | POLLNVAL)) {
+                return -1;
+            }
+            const int fd = ::accept(fd_, nullptr, nullptr);
+            if(fd >= 0) {
+                // Some systems pass the non-blocking flag on to the accepted socket.
+                fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) & ~O_NONBLOCK);
+                return fd;
+            }
+            if(errno != EINTR and errno != EAGAIN and errno != EWOULDBLOCK and errno != ECONNABORTED) {
+                return -1;
+            }
+        }
+    }
+
+    //! Stop accepting clients, which unblocks \ref accept. Can be called from any thread, any number of times.
+    void shutdown()
+    {
+        const char byte = 0;
+        [[maybe_unused]] const auto written = ::write(stop_[1], &byte, 1);
+    }
+};
@@ -1,9 +1,12 @@
 #include "../utils.hpp"
 
 #include "ioh/common/optimization_type.hpp"
+#include "ioh/common/cache.hpp"
 #include "ioh/common/log.hpp"
 #include "ioh/common/factory.hpp"
 #include "ioh/common/file.hpp"
+#include "ioh/common/math.hpp"
+#include "ioh/common/random.hpp"
 
 
 TEST_F(BaseTest, common_test)
@@ -65,3 +68,79 @@ TEST_F(BaseTest, common_unique_folder) {
     f2.remove();
     EXPECT_FALSE(fs::exists(f2.path()));
 }
+
+TEST_F(BaseTest, common_math)
+{
+    namespace math = ioh::common::math;
+    // The bounds are loose enough to also hold when compiled with -ffast-math
+    for (const auto x : ioh::common::random::doubles(10000, -700., 700.))
+        EXPECT_NEAR(math::exp(x) / std::exp(x), 1., 1e-12) << x;
+
+    for (const auto x : ioh::common::random::doubles(10000, -700., 700.))
+    {
+        const auto y = std::exp(x);
+        EXPECT_NEAR(math::log(y), std::log(y), 1e-12 * std::max(1., std::abs(std::log(y)))) << y;
+    }
+
+    for (const auto x : ioh::common::random::doubles(10000, -1000., 1000.))
+    {
+        EXPECT_NEAR(math::sin(x), std::sin(x), 1e-12) << x;
+        EXPECT_NEAR(math::cos(x), std::cos(x), 1e-12) << x;
+    }
+    for (const auto x : {-3e15, -2e9, 1.5e9, 7e12, 1e300})
+    {
+        EXPECT_DOUBLE_EQ(math::sin(x), std::sin(x)) << x;
+        EXPECT_DOUBLE_EQ(math::cos(x), std::cos(x)) << x;
+    }
+
+    for (const auto x : ioh::common::random::doubles(10000, 1e-3, 1e3))
+        EXPECT_NEAR(math::pow(x, 2.5) / std::pow(x, 2.5), 1., 1e-12) << x;
+
+    EXPECT_DOUBLE_EQ(math::exp(0.), 1.);
+    EXPECT_DOUBLE_EQ(math::log(1.), 0.);
+    EXPECT_DOUBLE_EQ(math::exp(-800.), 0.);
+    EXPECT_DOUBLE_EQ(math::sin(0.), 0.);
+    EXPECT_DOUBLE_EQ(math::cos(0.), 1.);
+}
+
+TEST_F(BaseTest, common_instance_cache)
+{
+    using namespace ioh::common::cache;
+    const auto directory = fs::temp_directory_path() / "ioh-instance-cache-test";
+    fs::remove_all(directory);
+
+    const Key key{"test", 1, 2, 3, {0.5}};
+    const Sections sections{{1., 2., 3.}, {}, {4.}};
+
+    InstanceCache::disable();
+    EXPECT_FALSE(InstanceCache::store(key, sections));
+    EXPECT_FALSE(InstanceCache::load(key).has_value());
+
+    InstanceCache::enable(directory, 16);
+    EXPECT_FALSE(InstanceCache::store(key, sections));
+
+    InstanceCache::enable(directory);
+    EXPECT_TRUE(InstanceCache::store(key, sections));
+    EXPECT_EQ(InstanceCache::load(key), sections);
+    EXPECT_FALSE(InstanceCache::load({"test", 1, 2, 3, {0.25}}).has_value());
+
+    {
+        std::fstream file(directory / key.file_name(), std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(-1, std::ios::end);
+        file.put('x');
+    }
+    EXPECT_FALSE(InstanceCache::load(key).has_value());
+
+    // A section larger than the file is refused before being allocated
+    EXPECT_TRUE(InstanceCache::store(key, sections));
+    {
+        std::fstream file(directory / key.file_name(), std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(sizeof(ioh::common::cache::detail::Header));
+        const auto size = std::numeric_limits<uint64_t>::max();
+        file.write(reinterpret_cast<const char *>(&size), sizeof(size));
+    }
+    EXPECT_FALSE(InstanceCache::load(key).has_value());
+
+    InstanceCache::disable();
+    fs::remove_all(directory);
+}
@@ -50,3 +50,58 @@ TEST_F(BaseTest, experiment_bbob)
 	EXPECT_EQ(ii, (std::set<int>{1, 2}));
 	EXPECT_EQ(di, (std::set<int>{2, 10}));
 }
+
+TEST_F(BaseTest, experiment_budget_and_target)
+{
+	using namespace ioh;
+
+	const auto suite  = std::make_shared<suite::PBO>(std::vector<int>{1}, std::vector<int>{1}, std::vector<int>{4});
+	const auto logger = std::make_shared<logger::Store>(
+		logger::Triggers{trigger::always}, logger::Properties{watch::evaluations});
+
+	// An algorithm that never stops by itself, and enumerates all bit strings of length 4
+	size_t calls = 0;
+	const auto enumerate = [&calls](const std::shared_ptr<problem::Integer>& p) {
+		for (auto i = 0;; i = (i + 1) % 16)
+		{
+			calls++;
+			(*p)({i & 1, (i >> 1) & 1, (i >> 2) & 1, (i >> 3) & 1});
+		}
+	};
+	auto experiment = Experimenter<problem::Integer>(suite, logger, enumerate, 2);
+	experiment.budget(100);
+	experiment.target_precision(0);
+	experiment.run();
+
+	// The optimum is the last bit string, so each run stops right after 16 evaluations
+	EXPECT_EQ(calls, 2 * 17);
+	for (const auto& [instance, runs]: logger->data().at("PBO").at(1).at(4))
+		for (const auto& [run, evaluations]: runs)
+			EXPECT_EQ(evaluations.size(), 16);
+
+	// The problems of the suite get their settings back after the experiment
+	for (const auto& p : *suite)
+	{
+		EXPECT_EQ(p->budget(), std::numeric_limits<int>::max());
+		EXPECT_FALSE(p->target_value().has_value());
+		EXPECT_EQ(p->termination(), problem::Termination::Flag);
+	}
+
+	auto problem = problem::pbo::OneMax(1, 4);
+	problem.set_budget(2);
+	problem.set_termination(problem::Termination::Refuse);
+	problem({0, 0, 0, 0});
+	EXPECT_FALSE(problem.terminated());
+	problem({0, 0, 0, 1});
+	EXPECT_TRUE(problem.terminated());
+	EXPECT_TRUE(ioh::common::is_nan(problem({1, 1, 1, 1})));
+	EXPECT_EQ(problem.state().evaluations, 2);
+	problem.reset();
+	EXPECT_FALSE(problem.terminated());
+
+	// Without a target, only the budget terminates the run
+	auto unbounded = problem::pbo::OneMax(1, 4);
+	unbounded.set_budget(100);
+	unbounded({0, 0, 0, 0});
+	EXPECT_FALSE(unbounded.terminated());
+}
@@ -73,6 +73,56 @@ TEST_F(BaseTest, logger_v1)
     EXPECT_TRUE(!fs::exists(output_directory));
 }
 
+TEST_F(BaseTest, logger_v1_switch_back)
+{
+    using namespace ioh;
+    auto p = problem::bbob::Sphere(1, 2);
+    auto p2 = problem::bbob::AttractiveSector(1, 4);
+    fs::path output_directory;
+    {
+        logger::Analyzer l({trigger::on_improvement}, {}, fs::current_path(), "ioh_data", "algorithm_name",
+                           "algorithm_info", false, {}, true);
+        output_directory = l.output_directory();
+
+        // Switching back to a problem goes on writing its files.
+        for (auto *problem : std::array<ioh::problem::BBOB *, 3>({&p, &p2, &p}))
+        {
+            problem->attach_logger(l);
+            (*problem)(std::vector<double>(problem->meta_data().n_variables, 0.));
+            problem->detach_logger();
+            problem->reset();
+        }
+    }
+
+    const std::string block =
+        R"(suite = "unknown_suite", funcId = 1, funcName = "Sphere", DIM = 2, maximization = "F", algId = "algorithm_name", algInfo = "algorithm_info")"
+        "\n%\ndata_f1_Sphere/IOHprofiler_f1_DIM2.dat, 1:1|1.40209";
+    compare_file_with_string(output_directory / "IOHprofiler_f1_Sphere.info", block + "\n" + block);
+
+    const std::string data =
+        R"#("function evaluation" "current f(x)" "best-so-far f(x)" "current af(x)+b" "best af(x)+b")#"
+        "\n1 1.4020940800 1.4020940800 80.8820940800 80.8820940800\n";
+    compare_file_with_string(get_dat_path(output_directory, p), data + data);
+    fs::remove_all(output_directory);
+
+    {
+        logger::Analyzer l;
+        output_directory = l.output_directory();
+
+        // By default, the files of a problem attached again are truncated.
+        for (auto *problem : std::array<ioh::problem::BBOB *, 3>({&p, &p2, &p}))
+        {
+            problem->attach_logger(l);
+            (*problem)(std::vector<double>(problem->meta_data().n_variables, 0.));
+            problem->detach_logger();
+            problem->reset();
+        }
+    }
+    compare_file_with_string(output_directory / "IOHprofiler_f1_Sphere.info", block);
+    compare_file_with_string(get_dat_path(output_directory, p), data);
+    fs::remove_all(output_directory);
+}
+
 TEST_F(BaseTest, structures)
 {
     using namespace ioh::logger::analyzer::structures;
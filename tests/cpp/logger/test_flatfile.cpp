@@ -3,6 +3,7 @@
 #include "ioh/logger/flatfile.hpp"
 #include "ioh/problem/bbob/sphere.hpp"
 #include "ioh/problem/bbob/attractive_sector.hpp"
+#include "ioh/problem/pbo/one_max.hpp"
 
 using namespace ioh;
 
@@ -35,3 +36,28 @@ TEST_F(BaseTest, logger_flatfile)
     fs::remove("./IOH.dat");
     EXPECT_TRUE(!fs::exists("./IOH.dat"));
 }
+
+TEST_F(BaseTest, logger_flatfile_integer_positions)
+{
+    auto p = problem::pbo::OneMax(1, 4);
+    const std::vector<int> x = {1, 0, 1, 1};
+
+    trigger::Always always;
+    watch::TransformedY transformed_y;
+    {
+        auto logger = logger::FlatFile({always}, {transformed_y}, "IOH-positions.dat", ".", " ", "# ", "None", "\n",
+                                       false, true);
+        p.attach_logger(logger);
+        p(x);
+
+        // The logged solution is a view of the state of the problem, in its native type
+        EXPECT_EQ(4, p.log_info().current.x.size());
+        EXPECT_NE(nullptr, p.log_info().current.x.ints());
+        EXPECT_EQ(nullptr, p.log_info().current.x.doubles());
+        EXPECT_EQ(std::vector<double>({1, 0, 1, 1}), p.log_info().current.as_double().x);
+    }
+    const auto contents = get_file_as_string("./IOH-positions.dat");
+    EXPECT_NE(std::string::npos, contents.find("x0 x1 x2 x3"));
+    EXPECT_NE(std::string::npos, contents.find("1.000000 0.000000 1.000000 1.000000"));
+    fs::remove("./IOH-positions.dat");
+}
@@ -0,0 +1,88 @@
+#include <atomic>
+#include <chrono>
+
+#include "../utils.hpp"
+
+#include "ioh/problem.hpp"
+
+using namespace ioh::problem;
+
+TEST_F(BaseTest, async_evaluation)
+{
+    // The later a solution is submitted, the sooner it is evaluated, yet it is committed in submission order
+    std::vector<double> committed;
+    std::atomic<int> evaluated{0};
+    const auto problem = std::make_shared<WrappedProblem<double>>(
+        [&evaluated](const std::vector<double> &x) {
+            ++evaluated;
+            std::this_thread::sleep_for(std::chrono::milliseconds(static_cast<int>(8 - x[0])));
+            return x[0] + x[1];
+        },
+        "Async", 2, 0, 1, ioh::common::OptimizationType::Minimization, Constraint<double>(),
+        utils::identity<std::vector<double>, int>,
+        [&committed](const double y, const int) {
+            committed.push_back(y);
+            return y;
+        });
+
+    AsyncEvaluator<double> evaluator(problem, 4);
+    EXPECT_EQ(4, evaluator.n_workers());
+
+    std::vector<std::future<double>> futures;
+    for (auto i = 0; i < 8; ++i)
+        futures.push_back(evaluator.submit({static_cast<double>(i), 1.0}));
+    futures.push_back(evaluator.submit({1.0}));
+
+    for (auto i = 0; i < 8; ++i)
+        EXPECT_DOUBLE_EQ(i + 1.0, futures[i].get());
+    EXPECT_TRUE(ioh::common::is_nan(futures.back().get()));
+
+    evaluator.wait();
+    EXPECT_EQ(0, evaluator.in_flight());
+    EXPECT_EQ((std::vector<double>{1, 2, 3, 4, 5, 6, 7, 8}), committed);
+    EXPECT_EQ(8, problem->state().evaluations);
+    EXPECT_DOUBLE_EQ(1.0, problem->state().current_best.y);
+    EXPECT_EQ((std::vector<double>{7.0, 1.0}), problem->state().current.x);
+
+    // Solutions committed after the budget is spent are refused, without being evaluated
+    problem->reset();
+    evaluated = 0;
+    problem->set_budget(3);
+    problem->set_termination(Termination::Refuse);
+    futures.clear();
+    for (auto i = 0; i < 5; ++i)
+        futures.push_back(evaluator.submit({static_cast<double>(i), 0.0}));
+    for (auto i = 0; i < 5; ++i)
+        EXPECT_EQ(i >= 3, ioh::common::is_nan(futures[i].get()));
+    EXPECT_EQ(3, problem->state().evaluations);
+    EXPECT_EQ(3, evaluated);
+
+    problem->set_termination(Termination::Abort);
+    EXPECT_THROW(evaluator.submit({0.0, 0.0}), RunTerminated);
+
+    evaluator.close();
+    EXPECT_THROW(evaluator.submit({0.0, 0.0}), std::runtime_error);
+}
+
+TEST_F(BaseTest, async_evaluation_serial)
+{
+    // Problems which cannot be evaluated concurrently use a single worker
+    const auto problem = std::make_shared<pbo::OneMaxDummy1>(1, 16);
+    auto reference = pbo::OneMaxDummy1(1, 16);
+    AsyncEvaluator<int> evaluator(problem, 4);
+    EXPECT_EQ(1, evaluator.n_workers());
+
+    std::vector<std::vector<int>> xs;
+    std::vector<std::future<double>> futures;
+    for (auto i = 0; i < 16; ++i)
+    {
+        std::vector<int> x(16, 0);
+        std::fill(x.begin(), x.begin() + i, 1);
+        futures.push_back(evaluator.submit(x));
+        xs.push_back(x);
+    }
+
+    for (auto i = 0; i < 16; ++i)
+        EXPECT_DOUBLE_EQ(reference(xs[i]), futures[i].get());
+    EXPECT_EQ(reference.state().current_best.x, problem->state().current_best.x);
+}
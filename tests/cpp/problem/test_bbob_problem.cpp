@@ -132,4 +132,195 @@ TEST_F(BaseTest, xopt_equals_yopt_bbob)
         auto problem = problem_factory.create(name, 1, 16);
         EXPECT_DOUBLE_EQ(problem->objective().y, (*problem)(problem->objective().x)) << *problem;
     }
-}
\ No newline at end of file
+}
+template <typename P, int N>
+void expect_same_fixed(const int instance)
+{
+    auto problem = P(instance, N);
+    auto fixed = ioh::problem::bbob::Fixed<P, N>(instance);
+    // The unrolled loops may be evaluated in another order under -ffast-math, hence the relative tolerance. It is
+    // loose because GriewankRosenBrock takes the cosine of terms up to 1e4, which amplifies the rounding errors
+    for (auto i = 0; i < 25; ++i)
+    {
+        const auto x = ioh::common::random::doubles(N, -5., 5.);
+        const auto y = problem(x);
+        EXPECT_NEAR(y, fixed(x), 1e-9 * std::max(1.0, std::abs(y))) << problem;
+    }
+    EXPECT_EQ(problem.meta_data(), fixed.meta_data());
+    const auto y_opt = fixed.objective().y;
+    EXPECT_NEAR(fixed(fixed.objective().x), y_opt, 1e-9 * std::max(1.0, std::abs(y_opt))) << fixed;
+}
+
+template <int N>
+void expect_same_fixed_all()
+{
+    using namespace ioh::problem::bbob;
+    expect_same_fixed<Sphere, N>(1);
+    expect_same_fixed<Ellipsoid, N>(2);
+    expect_same_fixed<Rastrigin, N>(3);
+    expect_same_fixed<BuecheRastrigin, N>(4);
+    expect_same_fixed<LinearSlope, N>(5);
+    expect_same_fixed<AttractiveSector, N>(6);
+    expect_same_fixed<StepEllipsoid, N>(7);
+    expect_same_fixed<Rosenbrock, N>(8);
+    expect_same_fixed<RosenbrockRotated, N>(9);
+    expect_same_fixed<EllipsoidRotated, N>(10);
+    expect_same_fixed<Discus, N>(11);
+    expect_same_fixed<BentCigar, N>(12);
+    expect_same_fixed<SharpRidge, N>(13);
+    expect_same_fixed<DifferentPowers, N>(14);
+    expect_same_fixed<RastriginRotated, N>(15);
+    expect_same_fixed<Weierstrass, N>(1);
+    expect_same_fixed<Schaffers10, N>(2);
+    expect_same_fixed<Schaffers1000, N>(3);
+    expect_same_fixed<GriewankRosenBrock, N>(4);
+    expect_same_fixed<Schwefel, N>(5);
+    expect_same_fixed<Gallagher101, N>(6);
+    expect_same_fixed<Gallagher21, N>(7);
+    expect_same_fixed<Katsuura, N>(8);
+    expect_same_fixed<LunacekBiRastrigin, N>(9);
+}
+
+TEST_F(BaseTest, bbob_fixed_dimension)
+{
+    expect_same_fixed_all<2>();
+    expect_same_fixed_all<5>();
+    expect_same_fixed_all<20>();
+
+    const auto &factory = ioh::problem::ProblemRegistry<ioh::problem::Real>::instance();
+    const auto problem = factory.create("Sphere<5>", 1, 5);
+    EXPECT_EQ(problem->meta_data().n_variables, 5);
+    EXPECT_EQ(problem->meta_data().problem_id, 1);
+    EXPECT_NE(factory.map().at(1), "Sphere<5>");
+    EXPECT_THROW(factory.create("Sphere<5>", 1, 4), std::invalid_argument);
+}
+
+//! Gives access to the evaluation method of a problem, skipping the transformations
+template <typename ProblemType>
+struct RawEvaluation : ProblemType
+{
+    using ProblemType::ProblemType;
+    using ProblemType::evaluate;
+};
+
+TEST_F(BaseTest, bbob_series_kernels)
+{
+    using namespace ioh::problem::bbob;
+    for (const auto dimension : {2, 10, 40})
+    {
+        RawEvaluation<Weierstrass> weierstrass(1, dimension);
+        RawEvaluation<Katsuura> katsuura(1, dimension);
+
+        for (auto s = 0; s < 100; ++s)
+        {
+            const auto x = ioh::common::random::pbo::uniform(dimension, s, -5, 5);
+
+            // Direct formulas of the series, with cos and pow per term
+            auto f0 = 0.0, weierstrass_sum = 0.0;
+            for (auto k = 0; k < 12; ++k)
+                f0 += pow(0.5, k) * cos(IOH_PI * pow(3., k));
+            for (const auto xi : x)
+                for (auto k = 0; k < 12; ++k)
+                    weierstrass_sum += pow(0.5, k) * cos(2 * IOH_PI * (xi + 0.5) * pow(3., k));
+            const auto weierstrass_expected = 10.0 * pow(weierstrass_sum / dimension - f0, 3.0);
+            EXPECT_NEAR(weierstrass.evaluate(x), weierstrass_expected,
+                        1e-9 * std::max(1.0, std::abs(weierstrass_expected)));
+
+            auto katsuura_product = 1.0;
+            for (auto i = 0; i < dimension; ++i)
+            {
+                auto z = 0.0;
+                for (auto j = 1; j < 33; ++j)
+                    z += fabs(pow(2., j) * x[i] - floor(pow(2., j) * x[i] + 0.5)) / pow(2., j);
+                katsuura_product *= pow(1.0 + (i + 1) * z, 10. / pow(dimension, 1.2));
+            }
+            const auto katsuura_expected = 10. / dimension / dimension * (katsuura_product - 1.);
+            // The sums are exact, but the product may be rounded differently with -ffast-math
+            EXPECT_NEAR(katsuura.evaluate(x), katsuura_expected, 1e-12 * std::max(1.0, std::abs(katsuura_expected)));
+        }
+    }
+}
+
+TEST_F(BaseTest, bbob_gallagher_batch)
+{
+    using namespace ioh::problem::bbob;
+    for (const auto dimension : {2, 10, 40})
+    {
+        Gallagher101 single(3, dimension), batch(3, dimension);
+        Gallagher21 single21(3, dimension), batch21(3, dimension);
+
+        std::vector<std::vector<double>> xs;
+        for (auto i = 0; i < 21; ++i)
+            xs.push_back(ioh::common::random::pbo::uniform(dimension, i, -5, 5));
+        xs.push_back(batch.objective().x);
+        xs.push_back(std::vector<double>(dimension, std::numeric_limits<double>::quiet_NaN()));
+
+        const auto ys = batch(xs);
+        const auto ys21 = batch21(xs);
+        ASSERT_EQ(ys.size(), xs.size());
+        for (size_t i = 0; i + 1 < xs.size(); ++i)
+        {
+            EXPECT_DOUBLE_EQ(ys[i], single(xs[i]));
+            EXPECT_DOUBLE_EQ(ys21[i], single21(xs[i]));
+        }
+        EXPECT_TRUE(ioh::common::is_nan(ys.back()));
+        EXPECT_DOUBLE_EQ(ys[xs.size() - 2], batch.objective().y);
+        EXPECT_EQ(batch.state().evaluations, single.state().evaluations);
+        EXPECT_DOUBLE_EQ(batch.state().current_best.y, single.state().current_best.y);
+    }
+}
+
+//! Gives access to the transformation state of a problem
+struct RotationAccess : ioh::problem::bbob::RastriginRotated
+{
+    using RastriginRotated::RastriginRotated;
+    const TransformationState &state() const { return transformation_state_; }
+};
+
+TEST_F(BaseTest, bbob_parallel_rotations)
+{
+    const auto dimension = 80;
+    EXPECT_FALSE(ioh::problem::BBOB::parallel_rotations);
+    const RotationAccess sequential(2, dimension);
+    ioh::problem::BBOB::parallel_rotations = true;
+    const RotationAccess parallel(2, dimension);
+    ioh::problem::BBOB::parallel_rotations = false;
+
+    EXPECT_EQ(sequential.state().first_rotation, parallel.state().first_rotation);
+    EXPECT_EQ(sequential.state().second_rotation, parallel.state().second_rotation);
+    EXPECT_EQ(sequential.state().second_transformation_matrix, parallel.state().second_transformation_matrix);
+
+    const auto &rotation = parallel.state().second_rotation;
+    for (auto i = 0; i < dimension; ++i)
+        for (auto j = 0; j < dimension; ++j)
+        {
+            auto prod = 0.0;
+            for (auto k = 0; k < dimension; ++k)
+                prod += rotation[k][i] * rotation[k][j];
+            EXPECT_NEAR(prod, i == j ? 1.0 : 0.0, 1e-12);
+        }
+}
+
+TEST_F(BaseTest, bbob_instance_cache)
+{
+    using ioh::common::cache::InstanceCache;
+    const auto directory = fs::temp_directory_path() / "ioh-bbob-instance-cache-test";
+    fs::remove_all(directory);
+
+    const std::vector<double> x{0.1, -1.2, 3.4, 2.0, -4.1};
+    ioh::problem::bbob::Gallagher101 generated(3, 5);
+    ioh::problem::bbob::RosenbrockRotated rotated(3, 5);
+
+    InstanceCache::enable(directory);
+    ioh::problem::bbob::Gallagher101 stored(3, 5);
+    ioh::problem::bbob::Gallagher101 loaded(3, 5);
+    ioh::problem::bbob::RosenbrockRotated rotated_loaded(3, 5);
+    InstanceCache::disable();
+
+    EXPECT_EQ(std::distance(fs::directory_iterator(directory), fs::directory_iterator()), 3);
+    EXPECT_EQ(loaded.objective().x, generated.objective().x);
+    EXPECT_EQ(loaded(x), generated(x));
+    EXPECT_EQ(stored(x), generated(x));
+    EXPECT_EQ(rotated_loaded(x), rotated(x));
+    fs::remove_all(directory);
+}
@@ -0,0 +1,74 @@
+#include "../utils.hpp"
+
+#include "ioh/problem/bbob.hpp"
+#include "ioh/problem/pbo.hpp"
+
+using namespace ioh::problem;
+
+TEST_F(BaseTest, evaluation_cache_eviction)
+{
+    for (const auto eviction : {CacheEviction::LRU, CacheEviction::Clock})
+    {
+        EvaluationCache<int> cache(2, eviction);
+        const std::vector<int> a = {0, 1, 1}, b = {1, 1, 1}, c = {2, 0, 0};
+        cache.insert(a, {1, 1});
+        cache.insert(b, {2, 2});
+        EXPECT_DOUBLE_EQ(1, cache.find(a)->y);
+
+        // b is the least recently used, and the only one not referenced since the hand passed
+        cache.insert(c, {3, -3});
+        EXPECT_FALSE(cache.find(b).has_value());
+        EXPECT_DOUBLE_EQ(1, cache.find(a)->internal_y);
+        EXPECT_DOUBLE_EQ(-3, cache.find(c)->y);
+
+        const auto statistics = cache.statistics();
+        EXPECT_EQ(3, statistics.hits);
+        EXPECT_EQ(1, statistics.misses);
+        EXPECT_EQ(1, statistics.evictions);
+        EXPECT_EQ(2, statistics.size);
+        EXPECT_DOUBLE_EQ(0.75, statistics.hit_rate());
+    }
+
+    // Bit strings and other integer points are packed differently, and never collide
+    EvaluationCache<int> cache(4);
+    cache.insert({1}, {1, 1});
+    EXPECT_FALSE(cache.find({2}).has_value());
+    EXPECT_TRUE(cache.find({1}).has_value());
+}
+
+TEST_F(BaseTest, problem_memoization)
+{
+    auto reference = pbo::LeadingOnes(2, 10);
+    auto problem = pbo::LeadingOnes(2, 10);
+    problem.enable_memoization(8);
+
+    std::vector<std::vector<int>> xs;
+    for (auto i = 0; i < 12; ++i)
+    {
+        std::vector<int> x;
+        for (const auto u : ioh::common::random::pbo::uniform(10, i % 5 == 4 ? 0 : i))
+            x.push_back(u > 0.5);
+        xs.push_back(x);
+    }
+
+    for (const auto &x : xs)
+        EXPECT_DOUBLE_EQ(reference(x), problem(x));
+    EXPECT_EQ(reference.state().evaluations, problem.state().evaluations);
+    EXPECT_DOUBLE_EQ(reference.state().current_best.y, problem.state().current_best.y);
+    EXPECT_EQ(reference.state().current_best.x, problem.state().current_best.x);
+    EXPECT_EQ(2, problem.memoization_statistics().hits);
+
+    // Free hits do not count as evaluations
+    auto bbob = bbob::Katsuura(1, 5);
+    const std::vector<double> x0 = {1, 2, 3, 4, 5};
+    const auto y0 = bbob(x0);
+    bbob.enable_memoization(4, CacheEviction::Clock, CacheHits::Free);
+    EXPECT_DOUBLE_EQ(y0, bbob(x0));
+    EXPECT_DOUBLE_EQ(y0, bbob(x0));
+    EXPECT_EQ(2, bbob.state().evaluations);
+    EXPECT_EQ(1, bbob.memoization_statistics().hits);
+    EXPECT_EQ(1, bbob.memoization_statistics().size);
+
+    bbob.disable_memoization();
+    EXPECT_EQ(0, bbob.memoization_statistics().capacity);
+}
@@ -1,6 +1,7 @@
 #include "../utils.hpp" 
 
 #include "ioh/problem/pbo.hpp"
+#include "ioh/logger/flatfile.hpp"
 
 double test_eval(const std::shared_ptr<ioh::problem::Integer> &f)
 {
@@ -179,4 +180,56 @@ TEST_F(BaseTest, origin_x)
     for(size_t i = 0; i!= x7.size(); ++i) {
         EXPECT_EQ(x7.at(i), xt.at(i));
     }
-}
\ No newline at end of file
+}
+
+TEST_F(BaseTest, pbo_state_tracking)
+{
+    using namespace ioh::problem;
+    auto problem = pbo::OneMax(1, 8);
+    const std::vector<int> x0 = {1, 1, 0, 0, 0, 0, 0, 0};
+    const std::vector<int> x1 = {1, 1, 1, 1, 0, 0, 0, 0};
+    EXPECT_EQ(StateTracking::Full, problem.state_tracking());
+
+    problem.set_state_tracking(StateTracking::Objectives);
+    problem(x0);
+    problem(x1);
+    EXPECT_EQ(2, problem.state().evaluations);
+    EXPECT_DOUBLE_EQ(problem(x1), problem.state().current_best.y);
+    EXPECT_TRUE(problem.state().current.x.empty() || problem.state().current.x != x1);
+    EXPECT_NE(x1, problem.state().current_best.x);
+
+    problem.reset();
+    problem.set_state_tracking(StateTracking::Evaluations);
+    EXPECT_DOUBLE_EQ(4.0, problem(x1));
+    EXPECT_EQ(1, problem.state().evaluations);
+    EXPECT_NE(4.0, problem.state().current_best.y);
+    EXPECT_FALSE(problem.state().optimum_found);
+    problem(std::vector<int>(8, 1));
+    EXPECT_TRUE(problem.state().optimum_found);
+    problem.reset();
+
+    // Loggers raise the level to what they read
+    ioh::trigger::Always always;
+    ioh::watch::TransformedY transformed_y;
+    {
+        auto flatfile = ioh::logger::FlatFile({always}, {transformed_y}, "IOH-tracking.dat", ".");
+        problem.attach_logger(flatfile);
+        EXPECT_EQ(StateTracking::Objectives, problem.state_tracking());
+        problem.detach_logger();
+    }
+    EXPECT_EQ(StateTracking::Evaluations, problem.state_tracking());
+    {
+        auto flatfile = ioh::logger::FlatFile({always}, {transformed_y}, "IOH-tracking.dat", ".", "\t", "# ",
+                                              "None", "\n", false, true);
+        problem.attach_logger(flatfile);
+        EXPECT_EQ(StateTracking::Full, problem.state_tracking());
+        problem(x0);
+        EXPECT_EQ(x0, problem.state().current.x);
+        problem.detach_logger();
+    }
+    fs::remove("./IOH-tracking.dat");
+
+    problem.set_state_tracking(StateTracking::Full);
+    problem(x1);
+    EXPECT_EQ(x1, problem.state().current_best.x);
+}
@@ -0,0 +1,291 @@
+#include "../utils.hpp"
+
+#include <random>
+#include <thread>
+
+#include "ioh/problem/pbo.hpp"
+
+using namespace ioh::problem::submodular;
+
+// Run a test from the tests directory, which the entries of the instance lists are relative to
+struct InTestsDirectory
+{
+    fs::path previous = fs::current_path();
+    InTestsDirectory() { fs::current_path(find_test_file("..")); }
+    ~InTestsDirectory() { fs::current_path(previous); }
+};
+
+TEST_F(BaseTest, submodular_instance_registry)
+{
+    InTestsDirectory in_tests;
+    auto &registry = GraphRegistry::instance();
+    registry.clear();
+
+    // Problems on the same graph share it, it is loaded once
+    {
+        MaxCut a(1, 1, "example_list_maxcut"), b(1, 1, "example_list_maxcut");
+        EXPECT_EQ(a.meta_data().n_variables, b.meta_data().n_variables);
+        EXPECT_EQ(1, registry.size());
+        EXPECT_EQ(Graph::load_instance(0, false, "example_list_maxcut"),
+                  Graph::load_instance(0, false, "example_list_maxcut"));
+        // The same file on edges is another instance
+        EXPECT_NE(nullptr, Graph::load_instance(0, true, "example_list_maxcut"));
+        EXPECT_EQ(2, registry.size());
+    }
+
+    // The least recently used graphs are released once no problem uses them
+    registry.clear();
+    auto first = Graph::load_instance(0, false, "example_list_maxcut");
+    auto second = Graph::load_instance(1, false, "example_list_maxcut");
+    EXPECT_EQ(2, registry.size());
+    first.reset();
+    second.reset();
+    EXPECT_EQ(1, registry.size());
+    registry.clear();
+    EXPECT_EQ(0, registry.size());
+
+    registry.set_capacity(2);
+    first = Graph::load_instance(0, false, "example_list_maxcut");
+    const auto *address = first.get();
+    Graph::load_instance(1, false, "example_list_maxcut");
+    first.reset();
+    EXPECT_EQ(2, registry.size());
+    EXPECT_EQ(address, Graph::load_instance(0, false, "example_list_maxcut").get());
+    auto third = Graph::load_instance(2, false, "example_list_maxcut");
+    EXPECT_EQ(2, registry.size()); // The second graph was the least recently used one
+    EXPECT_EQ(address, Graph::load_instance(0, false, "example_list_maxcut").get());
+    third.reset();
+    registry.set_capacity(1);
+    EXPECT_EQ(1, registry.size());
+    registry.clear();
+    EXPECT_EQ(0, registry.size());
+
+    // Concurrent loads of the same graph wait for a single load
+    std::vector<std::shared_ptr<const GraphInstance>> loaded(4);
+    std::vector<std::thread> threads;
+    for (auto &graph : loaded)
+        threads.emplace_back([&graph] { graph = Graph::load_instance(3, false, "example_list_maxcut"); });
+    for (auto &thread : threads)
+        thread.join();
+    for (const auto &graph : loaded)
+        EXPECT_EQ(loaded[0], graph);
+    EXPECT_NE(nullptr, loaded[0]);
+    loaded.clear();
+    registry.clear();
+
+    // The instance lists are parsed once
+    const auto list = Helper::instance_list("example_list_maxcut");
+    ASSERT_NE(nullptr, list);
+    EXPECT_EQ(5, list->size());
+    EXPECT_EQ(list, Helper::instance_list("example_list_maxcut"));
+    EXPECT_EQ(nullptr, Helper::instance_list("no_such_list"));
+    EXPECT_EQ(nullptr, Graph::load_instance(5, false, "example_list_maxcut"));
+}
+
+// Flip random elements with the marginal gain oracle of problem, and compare it to full evaluations of reference.
+// The walk removes elements while the selection violates the constraint
+template <typename ProblemType>
+void expect_consistent_oracle(ProblemType &problem, ProblemType &reference, const int steps)
+{
+    const auto n = problem.meta_data().n_variables;
+    ASSERT_GT(n, 0);
+    std::mt19937 engine(42);
+    std::uniform_int_distribution<int> element(0, n - 1);
+    for (auto step = 0; step < steps; step++)
+    {
+        auto e = element(engine);
+        if (problem.constraint_slack() < 0) // Remove a selected element, so the selection stays near the constraint
+        {
+            const auto &selection = problem.selection();
+            while (selection[e] == 0)
+                e = element(engine);
+        }
+        const auto selected = problem.selection()[e] == 1;
+        const auto before = problem.selection_value();
+        const auto feasible = problem.constraint_slack() >= 0 && (selected || problem.constraint_slack_with(e) >= 0);
+        const auto gain = problem.marginal_gain(e);
+        const auto y = selected ? problem.remove_element(e) : problem.add_element(e);
+        const auto expected = reference(problem.selection());
+        EXPECT_NEAR(expected, y, 1e-9 * std::max(1.0, std::abs(expected))) << "step " << step;
+        EXPECT_NEAR(y, problem.selection_value(), 1e-9 * std::max(1.0, std::abs(y)));
+        if (selected)
+        {
+            EXPECT_EQ(0, gain);
+        }
+        else if (feasible) // The gain does not include the penalty of the constraint
+        {
+            EXPECT_NEAR(y - before, gain, 1e-9 * std::max(1.0, std::abs(y))) << "step " << step;
+        }
+    }
+    // Both the gains and the selections are counted, only the selections are logged
+    EXPECT_EQ(2 * steps, problem.state().evaluations);
+}
+
+TEST_F(BaseTest, submodular_marginal_gain)
+{
+    using ioh::problem::Termination;
+    InTestsDirectory in_tests;
+
+    MaxCut max_cut(1, 1, "example_list_maxcut"), max_cut_reference(1, 1, "example_list_maxcut");
+    expect_consistent_oracle(max_cut, max_cut_reference, 300);
+
+    MaxCoverage max_coverage(1, 1, "example_list_maxcoverage"),
+        max_coverage_reference(1, 1, "example_list_maxcoverage");
+    expect_consistent_oracle(max_coverage, max_coverage_reference, 300);
+
+    // Elements out of range are refused before anything is counted
+    const auto evaluations = max_cut.state().evaluations;
+    EXPECT_THROW(max_cut.add_element(-1), std::out_of_range);
+    EXPECT_THROW(max_cut.remove_element(max_cut.meta_data().n_variables), std::out_of_range);
+    EXPECT_THROW(max_cut.marginal_gain(max_cut.meta_data().n_variables), std::out_of_range);
+    EXPECT_THROW(max_cut.constraint_slack_with(-1), std::out_of_range);
+    EXPECT_EQ(evaluations, max_cut.state().evaluations);
+
+    // The oracle counts against the budget, and is refused once it is spent
+    max_cut.reset();
+    EXPECT_TRUE(max_cut.selection() == std::vector<int>(max_cut.meta_data().n_variables, 0));
+    max_cut.set_budget(2);
+    max_cut.set_termination(Termination::Refuse);
+    EXPECT_FALSE(ioh::common::is_nan(max_cut.marginal_gain(0)));
+    EXPECT_FALSE(ioh::common::is_nan(max_cut.add_element(0)));
+    EXPECT_TRUE(ioh::common::is_nan(max_cut.marginal_gain(1)));
+    EXPECT_TRUE(ioh::common::is_nan(max_cut.add_element(1)));
+    EXPECT_EQ(2, max_cut.state().evaluations);
+    EXPECT_EQ(0, max_cut.selection()[1]);
+    max_cut.set_termination(Termination::Abort);
+    EXPECT_THROW(max_cut.marginal_gain(1), ioh::problem::RunTerminated);
+}
+
+TEST_F(BaseTest, submodular_incremental_max_coverage)
+{
+    InTestsDirectory in_tests;
+    for (const auto instance : {1, 5})
+    {
+        MaxCoverage incremental(instance, 1, "example_list_maxcoverage"),
+            reference(instance, 1, "example_list_maxcoverage");
+        incremental.set_incremental_evaluation(true);
+        const auto n = incremental.meta_data().n_variables;
+        ASSERT_GT(n, 0);
+
+        std::mt19937 engine(instance);
+        std::uniform_int_distribution<int> element(0, n - 1), flips(1, 8);
+        std::vector<int> x(n, 0);
+        for (auto step = 0; step < 500; step++)
+        {
+            // Mostly a few flips, sometimes more than the changed fraction, which is evaluated from scratch
+            const auto n_flips = step % 50 == 49 ? n / 2 : flips(engine);
+            for (auto i = 0; i < n_flips; i++)
+            {
+                auto &bit = x[element(engine)];
+                bit = 1 - bit;
+            }
+            const auto expected = reference(x);
+            EXPECT_NEAR(expected, incremental(x), 1e-9 * std::max(1.0, std::abs(expected)))
+                << "instance " << instance << ", step " << step;
+        }
+    }
+}
+
+// The objective value of Packing While Travelling as computed on the original layout of the instance, with the
+// items grouped by city in the order of the TTP file
+double pack_while_travel_reference(const PackWhileTravelInstance &instance, const std::vector<std::vector<int>> &items,
+                                   const std::vector<std::vector<double>> &weights,
+                                   const std::vector<std::vector<double>> &profits, const std::vector<int> &x)
+{
+    double profit_sum = 0, cons = 0, time = 0;
+    for (size_t i = 0; i < weights.size(); i++)
+    {
+        for (size_t j = 0; j < weights[i].size(); j++)
+        {
+            if (x[items[i][j]] >= 1)
+            {
+                cons += weights[i][j];
+                profit_sum += profits[i][j];
+            }
+        }
+        if (cons > instance.capacity)
+            continue;
+        time += instance.distances[i] /
+            (instance.velocity_max - (instance.velocity_gap * cons / instance.capacity));
+    }
+    if (cons > instance.capacity)
+        return instance.capacity - cons + instance.penalty;
+    return profit_sum - time;
+}
+
+TEST_F(BaseTest, submodular_pack_while_travel)
+{
+    using namespace ioh::common::cache;
+    InTestsDirectory in_tests;
+    const std::string ttp_file = "example_pwt/a280_n279_bounded-strongly-corr_01.ttp";
+
+    // The items of the TTP file, grouped by city in file order
+    std::vector<std::vector<int>> items;
+    std::vector<std::vector<double>> weights, profits;
+    {
+        std::ifstream ttp(ttp_file);
+        std::string line;
+        while (std::getline(ttp, line) && line.rfind("ITEMS SECTION", 0) != 0)
+            ;
+        int index, city;
+        double profit, weight;
+        for (auto item = 0; ttp >> index >> profit >> weight >> city; item++)
+        {
+            if (static_cast<int>(items.size()) < city)
+            {
+                items.resize(city);
+                weights.resize(city);
+                profits.resize(city);
+            }
+            items[city - 1].push_back(item);
+            weights[city - 1].push_back(weight);
+            profits[city - 1].push_back(profit);
+        }
+    }
+
+    const auto directory = fs::temp_directory_path() / "ioh-pack-while-travel-test";
+    fs::remove_all(directory);
+    InstanceCache::enable(directory);
+    const PackWhileTravelInstance parsed(ttp_file);
+    EXPECT_EQ(1, std::distance(fs::directory_iterator(directory), fs::directory_iterator()));
+    const auto cached = std::make_shared<const PackWhileTravelInstance>(ttp_file);
+    InstanceCache::disable();
+    fs::remove_all(directory);
+
+    // The cached instance is the parsed one
+    ASSERT_FALSE(parsed.is_empty());
+    EXPECT_EQ(279, parsed.n_items);
+    EXPECT_EQ(parsed.n_items, cached->n_items);
+    EXPECT_EQ(parsed.capacity, cached->capacity);
+    EXPECT_EQ(parsed.velocity_gap, cached->velocity_gap);
+    EXPECT_EQ(parsed.velocity_max, cached->velocity_max);
+    EXPECT_EQ(parsed.penalty, cached->penalty);
+    EXPECT_EQ(parsed.distances, cached->distances);
+    EXPECT_EQ(parsed.city_offsets, cached->city_offsets);
+    EXPECT_EQ(parsed.item_weights, cached->item_weights);
+    EXPECT_EQ(parsed.item_profits, cached->item_profits);
+    EXPECT_EQ(parsed.item_index, cached->item_index);
+    EXPECT_EQ(static_cast<int>(items.size()), parsed.get_n_item_cities());
+
+    // Different paths to the same file share the instance
+    EXPECT_EQ(PackWhileTravel::load_file(ttp_file), PackWhileTravel::load_file("./" + ttp_file));
+    EXPECT_EQ(PackWhileTravel::load_file(ttp_file), PackWhileTravel::load_instance(0, "example_list_pwt"));
+
+    // The values on the flattened instance are the values on the original layout, with or without the cache
+    PackWhileTravel problem(1, 1, "example_list_pwt"), problem_cached(1, cached);
+    ASSERT_EQ(parsed.n_items, problem.meta_data().n_variables);
+    std::mt19937 engine(42);
+    for (const auto density : {0.0, 0.02, 0.1, 0.5, 1.0})
+    {
+        std::bernoulli_distribution selected(density);
+        for (auto repeat = 0; repeat < 10; repeat++)
+        {
+            std::vector<int> x(parsed.n_items);
+            for (auto &xi : x)
+                xi = selected(engine);
+            const auto expected = pack_while_travel_reference(parsed, items, weights, profits, x);
+            EXPECT_DOUBLE_EQ(expected, problem(x));
+            EXPECT_DOUBLE_EQ(expected, problem_cached(x));
+        }
+    }
+}
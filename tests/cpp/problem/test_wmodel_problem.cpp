@@ -31,3 +31,33 @@ TEST_F(BaseTest, WModel_Dummy)
     EXPECT_DOUBLE_EQ(problem_lo3(x1), 16);
     EXPECT_DOUBLE_EQ(problem_lo3(x0), 0);
 }
+
+
+template <typename Fixed, typename Runtime>
+void expect_same_wmodel(Fixed fixed, Runtime runtime)
+{
+    ioh::common::random::seed(42);
+    const auto n = fixed.meta_data().n_variables;
+    EXPECT_DOUBLE_EQ(fixed.objective().y, runtime.objective().y);
+    for (auto i = 0; i < 100; ++i)
+    {
+        const auto x = ioh::common::random::integers(n, 0, 1);
+        EXPECT_DOUBLE_EQ(fixed(x), runtime(x)) << fixed.meta_data();
+    }
+}
+
+TEST_F(BaseTest, WModel_Template)
+{
+    using namespace ioh::problem::wmodel;
+    expect_same_wmodel(WModelOneMaxT<false, 0, 0, 0>(1, 16), WModelOneMax(1, 16, 0, 0, 0, 0));
+    expect_same_wmodel(WModelOneMaxT<true, 0, 0, 0>(1, 16, 0.5), WModelOneMax(1, 16, 0.5, 0, 0, 0));
+    expect_same_wmodel(WModelOneMaxT<false, 3, 0, 0>(1, 16), WModelOneMax(1, 16, 0, 0, 3, 0));
+    expect_same_wmodel(WModelOneMaxT<false, 0, 4, 0>(1, 18), WModelOneMax(1, 18, 0, 4, 0, 0));
+    expect_same_wmodel(WModelOneMaxT<false, 0, 0, 2>(1, 16), WModelOneMax(1, 16, 0, 0, 0, 2));
+    expect_same_wmodel(WModelOneMaxT<true, 2, 3, 1>(5, 100, 0.9), WModelOneMax(5, 100, 0.9, 3, 2, 1));
+
+    expect_same_wmodel(WModelLeadingOnesT<false, 0, 0, 0>(1, 16), WModelLeadingOnes(1, 16, 0, 0, 0, 0));
+    expect_same_wmodel(WModelLeadingOnesT<false, 0, 1, 0>(1, 16), WModelLeadingOnes(1, 16, 0, 1, 0, 0));
+    expect_same_wmodel(WModelLeadingOnesT<true, 2, 5, 0>(55, 64, 0.8), WModelLeadingOnes(55, 64, 0.8, 5, 2, 0));
+    expect_same_wmodel(WModelLeadingOnesT<true, 3, 4, 2>(1, 50, 0.6), WModelLeadingOnes(1, 50, 0.6, 4, 3, 2));
+}
@@ -59,4 +59,86 @@ TEST_F(BaseTest, test_wrap_integer_problem){
         EXPECT_DOUBLE_EQ(static_cast<double>(inst) * 3, problem->objective().y);
         EXPECT_DOUBLE_EQ((fn<int>(x0) + inst - 1) * inst, (*problem)(x0));
     }
-}
\ No newline at end of file
+}
+
+TEST_F(BaseTest, test_wrap_batch_problem){
+    using namespace ioh::common;
+    using namespace ioh::problem;
+    auto &factory = ProblemRegistry<Real>::instance();
+
+    size_t calls = 0;
+    size_t evaluated = 0;
+    wrap_batch_function<double>(
+        [&calls, &evaluated](const std::vector<std::vector<double>> &xs) {
+            calls++;
+            evaluated += xs.size();
+            std::vector<double> ys;
+            for (const auto &x : xs)
+                ys.push_back(fn<double>(x));
+            return ys;
+        },
+        "batch_fn", OptimizationType::Minimization, -5, 5, tx<double>, ty);
+    const std::vector<std::vector<double>> xs = {
+        {1, 0, 2}, {3, 1, 1}, {std::numeric_limits<double>::quiet_NaN(), 0, 0}, {-1, -2, -3}};
+
+    auto problem = factory.create("batch_fn", 2, 3);
+    const auto ys = (*problem)(xs);
+    EXPECT_EQ(1, calls);
+    EXPECT_EQ(3, problem->state().evaluations);
+    EXPECT_DOUBLE_EQ((fn<double>(xs[0]) + 1) * 2, ys[0]);
+    EXPECT_DOUBLE_EQ((fn<double>(xs[1]) - 1) * 2, ys[1]);
+    EXPECT_TRUE(ioh::common::is_nan(ys[2]));
+    EXPECT_DOUBLE_EQ((fn<double>(xs[3]) + 3) * 2, ys[3]);
+    EXPECT_DOUBLE_EQ(ys[3], problem->state().current_best.y);
+
+    EXPECT_DOUBLE_EQ(ys[0], (*problem)(xs[0]));
+    EXPECT_EQ(2, calls);
+
+    // The points beyond the budget are not evaluated
+    problem->reset();
+    evaluated = 0;
+    problem->set_budget(2);
+    problem->set_termination(Termination::Refuse);
+    const auto refused = (*problem)(xs);
+    EXPECT_EQ(2, evaluated);
+    EXPECT_EQ(2, problem->state().evaluations);
+    EXPECT_DOUBLE_EQ(ys[1], refused[1]);
+    EXPECT_TRUE(ioh::common::is_nan(refused[3]));
+
+    problem->reset();
+    evaluated = 0;
+    problem->set_termination(Termination::Abort);
+    EXPECT_THROW((*problem)(xs), RunTerminated);
+    EXPECT_EQ(2, evaluated);
+    EXPECT_EQ(2, problem->state().evaluations);
+    EXPECT_TRUE(problem->terminated());
+}
+
+TEST_F(BaseTest, test_wrap_inlined_problem){
+    using namespace ioh::common;
+    using namespace ioh::problem;
+    auto &factory = ProblemRegistry<Real>::instance();
+
+    const auto f = [](const std::vector<double> &x) { return fn<double>(x); };
+    wrap_function<double>(fn<double>, "wrapped_fn", OptimizationType::Minimization, -5, 5, tx<double>, ty,
+                          co<double>);
+    wrap_inlined_function<double>(f, "inlined_fn", OptimizationType::Minimization, -5, 5, tx<double>, ty,
+                                  co<double>);
+    const std::vector<double> x0 = {1, 0, 2};
+
+    for (auto inst: {1, 2, 3}){
+        auto wrapped = factory.create("wrapped_fn", inst, 3);
+        auto inlined = factory.create("inlined_fn", inst, 3);
+        EXPECT_DOUBLE_EQ(-5, inlined->constraint().lb.at(0));
+        EXPECT_DOUBLE_EQ(wrapped->objective().y, inlined->objective().y);
+        EXPECT_DOUBLE_EQ((*wrapped)(x0), (*inlined)(x0));
+        EXPECT_DOUBLE_EQ(wrapped->state().current_best.y, inlined->state().current_best.y);
+    }
+
+    InlinedProblem<double, decltype(f)> problem(f, "inlined", 3);
+    EXPECT_DOUBLE_EQ(fn<double>(x0), problem(x0));
+    EXPECT_TRUE(ioh::common::is_nan(problem(std::vector<double>{1, 2})));
+    EXPECT_DOUBLE_EQ(fn<double>(x0), problem(std::vector<std::vector<double>>{x0}).at(0));
+    EXPECT_EQ(2, problem.state().evaluations);
+    EXPECT_DOUBLE_EQ(fn<double>(x0), problem.state().current_best.y);
+}
@@ -18,6 +18,23 @@ TEST_F(BaseTest, suite_factory)
         EXPECT_EQ(problem_ids.at(i), problems.at(i));
 }
 
+TEST_F(BaseTest, problem_factory_metadata)
+{
+    using namespace ioh;
+
+    // The ids registered from the compile-time metadata are those of the constructed problems
+    for (const auto &[id, name] : problem::ProblemFactoryType<problem::BBOB>::instance().map())
+        EXPECT_EQ(problem::ProblemFactoryType<problem::BBOB>::instance().create(id, 1, 2)->meta_data().problem_id, id)
+            << name;
+
+    for (const auto &[id, name] : problem::ProblemFactoryType<problem::PBO>::instance().map())
+        EXPECT_EQ(problem::ProblemFactoryType<problem::PBO>::instance().create(id, 1, 4)->meta_data().problem_id, id)
+            << name;
+
+    EXPECT_EQ(common::problem_id<problem::bbob::Sphere>(), 1);
+    EXPECT_EQ(common::problem_id<problem::pbo::NKLandscapes>(), 25);
+}
+
 TEST_F(BaseTest, problem_suite_bbob)
 {
     std::vector<int> ids(24);
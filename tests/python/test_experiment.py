@@ -61,6 +61,15 @@ class TestExperiment(unittest.TestCase):
 
         shutil.rmtree("ioh_data")
         os.remove("ioh_data.zip")
+
+    def test_experimenter_budget(self):
+        algorithm = Algorithm()
+        exp = ioh.Experiment(algorithm, [1], [1], [5], reps=2, logged=False, budget=100)
+        problem = ioh.get_problem(1, 1, 5)
+        exp.apply(algorithm, problem)
+        # The 101st evaluation aborts the run
+        self.assertEqual(algorithm.i, 99)
+        self.assertFalse(problem.terminated)
            
     
 
@@ -1,6 +1,7 @@
 import os
 import unittest
 import math
+import importlib.util
 
 import ioh
 
@@ -124,6 +125,28 @@ class TestProblem(unittest.TestCase):
                         p = ioh.get_problem(int(fid), int(iid), dim, suite.upper())
                         self.assertTrue(math.isclose(p(x), float(y), abs_tol = tol))
 
+    @unittest.skipUnless(importlib.util.find_spec("numpy"), "requires numpy")
+    def test_batch_evaluation(self):
+        import numpy as np
+
+        for problem_type, dtype in (("BBOB", np.float64), ("PBO", np.int32)):
+            p = ioh.get_problem(1, 1, 4, problem_type)
+            q = ioh.get_problem(1, 1, 4, problem_type)
+            xs = np.array([[0, 1, 1, 0], [1, 1, 1, 1], [0, 0, 0, 0]], dtype=dtype)
+            ys = p(xs)
+            self.assertIsInstance(ys, np.ndarray)
+            self.assertEqual(ys.shape, (3,))
+            for x, y in zip(xs, ys):
+                self.assertEqual(y, q(x.tolist()))
+            self.assertEqual(p.state.evaluations, 3)
+            self.assertEqual(p.state.current_best.y, q.state.current_best.y)
+
+        p = ioh.get_problem(1, 1, 4, "PBO")
+        self.assertEqual(p(np.array([[0, 1, 1, 0]], dtype=np.int64)).tolist(), [2.0])
+        with self.assertRaises(TypeError):
+            p(np.array([[0.5, 1, 1, 0]]))
+        self.assertEqual(p.state.evaluations, 1)
+
 
 
 if __name__ == "__main__":
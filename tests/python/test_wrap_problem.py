@@ -1,3 +1,4 @@
+import importlib.util
 import unittest
 
 import ioh
@@ -62,6 +63,41 @@ class TestWrappedProblem(unittest.TestCase):
             y = p([0]*5)
             self.assertEqual(y, 0.0)
 
+    @unittest.skipUnless(importlib.util.find_spec("numpy"), "requires numpy")
+    def test_wrap_problem_vectorized(self):
+        import numpy as np
+
+        batches = []
+
+        def f(xs):
+            batches.append(xs.shape)
+            return xs.sum(axis=1)
+
+        p = ioh.wrap_problem(f, "vectorized_sum", "Real", dimension=3, vectorized=True)
+        ys = p(np.array([[0, 1, 2], [1, 1, 1], [2, 2, 2]], dtype=np.float64))
+        self.assertEqual(list(ys), [3.0, 3.0, 6.0])
+        self.assertEqual(batches, [(3, 3)])
+        self.assertEqual(p.state.evaluations, 3)
+
+        self.assertEqual(p([1, 2, 3]), 6.0)
+        self.assertEqual(batches[-1], (1, 3))
+
+    def test_wrap_problem_async(self):
+        import time
+
+        def f(x):
+            time.sleep(0.01 * (3 - x[0]))
+            return sum(x)
+
+        p = ioh.wrap_problem(f, "async_sum", "Real", dimension=2)
+        evaluator = ioh.problem.RealAsyncEvaluator(p, 4)
+        futures = [evaluator.submit([i, 1]) for i in range(4)]
+        self.assertEqual([future.result() for future in futures], [1.0, 2.0, 3.0, 4.0])
+        evaluator.wait()
+        self.assertEqual(p.state.evaluations, 4)
+        self.assertEqual(p.state.current.x, [3.0, 1.0])
+        evaluator.close()
+
 
 if __name__ == "__main__":
     unittest.main()